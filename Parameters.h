@@ -30,6 +30,17 @@
 /* 1: choose the dimension first, then choose the element w.r.t. the noise it introduces in the present part of the search space (in present and potential in case of equality) */
 #define ENUMERATION_PROCESS 0
 
+// Data
+/* COMPRESSED_TUBES turns on, once the data are loaded, the conversion of every crisp tube into a Roaring-style compressed tube (whose containers are sorted arrays, bitmaps or runs) whenever it takes less memory. */
+#define COMPRESSED_TUBES
+
+/* SORTED_SPARSE_TUBES turns on, once the data are loaded, the conversion of every sparse fuzzy tube into a sorted vector of hyperplane ids and a parallel vector of noises, instead of a hash table. */
+#define SORTED_SPARSE_TUBES
+
+// Search state
+/* TRAIL turns on the exploration of the left subtrees in place: instead of copying the attributes and their noise counters at every node, the noise counters modified in a subtree are recorded and restored when the subtree has been explored. */
+#define TRAIL
+
 // Log
 /* VERBOSE_PARSER turns on the output (on the standard output) of information when the input data and group files are parsed. */
 /* #define VERBOSE_PARSER */
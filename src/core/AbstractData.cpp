@@ -10,6 +10,10 @@
 
 #include "AbstractData.h"
 
+AbstractData::AbstractData(const DataType dataTypeParam): dataType(dataTypeParam)
+{
+}
+
 AbstractData::~AbstractData()
 {
 }
@@ -18,3 +22,8 @@ const unsigned int AbstractData::depth() const
 {
   return 0;
 }
+
+AbstractData* AbstractData::compress()
+{
+  return this;
+}
@@ -18,26 +18,31 @@
 class AbstractData
 {
  public:
+  enum DataType { trieData, noNoiseTubeData, sparseCrispTubeData, denseCrispTubeData, compressedCrispTubeData, sparseFuzzyTubeData, sortedFuzzyTubeData, denseFuzzyTube8Data, denseFuzzyTube16Data, denseFuzzyTube32Data };
+
+  AbstractData(const DataType dataType);
   virtual ~AbstractData();
   virtual AbstractData* clone() const = 0;
 
   virtual void print(vector<unsigned int>& prefix, ostream& out) const = 0;
+  const DataType getDataType() const;
   virtual const unsigned int depth() const;
-  virtual const bool setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) = 0;
-  virtual const unsigned int setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, const unsigned int dimensionId) = 0;
-  virtual const unsigned int setSelfLoopsAfterSymmetricAttributes(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) = 0;
-
-  virtual const unsigned int setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const = 0;
-  virtual const unsigned int setPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const = 0;
-  virtual const unsigned int setSymmetricPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const = 0;
-  virtual const unsigned int setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const = 0;
-  virtual const unsigned int setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const = 0;
-  virtual const unsigned int setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const = 0;
-  virtual const unsigned int setAbsentAfterAbsentValuesMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const = 0;
-  virtual const unsigned int setSymmetricAbsentAfterAbsentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const = 0;
-  virtual const unsigned int setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const = 0;
-  virtual const unsigned int setAbsentAfterAbsentValuesMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const = 0;
-  virtual const unsigned int setSymmetricAbsentAfterAbsentValueMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const = 0;
+  virtual AbstractData* compress();
+  virtual const bool setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) = 0;
+  virtual const unsigned int setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId) = 0;
+  virtual const unsigned int setSelfLoopsAfterSymmetricAttributes(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) = 0;
+
+  virtual const unsigned int setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const = 0;
+  virtual const unsigned int setPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const = 0;
+  virtual const unsigned int setSymmetricPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const = 0;
+  virtual const unsigned int setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const = 0;
+  virtual const unsigned int setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const = 0;
+  virtual const unsigned int setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const = 0;
+  virtual const unsigned int setAbsentAfterAbsentValuesMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const = 0;
+  virtual const unsigned int setSymmetricAbsentAfterAbsentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const = 0;
+  virtual const unsigned int setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const = 0;
+  virtual const unsigned int setAbsentAfterAbsentValuesMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const = 0;
+  virtual const unsigned int setSymmetricAbsentAfterAbsentValueMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const = 0;
 
   virtual const unsigned int countNoise(const vector<vector<unsigned int>>::const_iterator dimensionIt) const = 0;
   virtual const bool decreaseMembershipDownToThreshold(const double membershipThreshold, const vector<vector<unsigned int>>::const_iterator dimensionIt, const vector<vector<unsigned int>::const_iterator>::iterator tupleIt, double& membershipSum) const = 0;
@@ -46,6 +51,14 @@ class AbstractData
   virtual const unsigned int countNoiseOnPresent(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const = 0;
   virtual const unsigned int countNoiseOnPresentAndPotential(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const = 0;
 #endif
+
+ protected:
+  const DataType dataType; /* to statically dispatch the calls (see Trie::dispatch) */
 };
 
+inline const AbstractData::DataType AbstractData::getDataType() const
+{
+  return dataType;
+}
+
 #endif /*ABSTRACT_DATA_H_*/
@@ -31,7 +31,7 @@ Attribute::Attribute(): id(0), values(), potentialIndex(0), irrelevantIndex(0),
 {
 }
 
-Attribute::Attribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels): id(maxId++), values(), potentialIndex(0), irrelevantIndex(0), absentIndex(0)
+Attribute::Attribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels, Arena& arena): id(maxId++), values(), potentialIndex(0), irrelevantIndex(0), absentIndex(0)
 {
   const vector<unsigned int>::const_iterator nbOfValuesInThisAttributeIt = nbOfValuesPerAttribute.begin() + id;
   irrelevantIndex = *nbOfValuesInThisAttributeIt;
@@ -61,49 +61,64 @@ Attribute::Attribute(const vector<unsigned int>& nbOfValuesPerAttribute, const d
   values.reserve(absentIndex);
   for (unsigned int valueId = 0; valueId != *nbOfValuesInThisAttributeIt; ++valueId)
     {
-      values.push_back(new Value(valueId, sizeOfAValue, nbOfValuesInNextAttributeIt, nbOfValuesPerAttribute.end(), noisesInIntersections));
+      values.push_back(arena.create<Value>(valueId, sizeOfAValue, nbOfValuesInNextAttributeIt, nbOfValuesPerAttribute.end(), noisesInIntersections, arena));
     }
   epsilonVector.push_back(epsilon * noisePerUnit);
   labelsVector.push_back(labels);
 }
 
-Attribute::Attribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd): id((*parentAttributeIt)->id), values(), potentialIndex((*parentAttributeIt)->potentialIndex), irrelevantIndex((*parentAttributeIt)->irrelevantIndex), absentIndex((*parentAttributeIt)->absentIndex)
+Attribute::Attribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena): id((*parentAttributeIt)->id), values(), potentialIndex((*parentAttributeIt)->potentialIndex), irrelevantIndex((*parentAttributeIt)->irrelevantIndex), absentIndex((*parentAttributeIt)->absentIndex)
 {
   const vector<Attribute*>::const_iterator parentNextAttributeIt = parentAttributeIt + 1;
   unsigned int newId = 0;
   values.reserve((*parentAttributeIt)->values.size());
   for (const Value* value : (*parentAttributeIt)->values)
     {
-      values.push_back(createChildValue(*value, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd));
+      values.push_back(createChildValue(*value, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena));
     }
 }
 
 Attribute::~Attribute()
 {
-  for (const Value* value : values)
-    {
-      delete value;
-    }
 }
 
-Attribute* Attribute::clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd) const
+Attribute* Attribute::clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena) const
+{
+  return new (arena.allocate(sizeof(Attribute), alignof(Attribute))) Attribute(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt, sizeOfAttributeEnd, arena);
+}
+
+#ifdef TRAIL
+Attribute::State Attribute::getState() const
 {
-  return new Attribute(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt, sizeOfAttributeEnd);
+  return {values, potentialIndex, irrelevantIndex, absentIndex};
 }
 
+void Attribute::setState(State&& state)
+{
+  values = std::move(state.values);
+  potentialIndex = state.potentialIndex;
+  irrelevantIndex = state.irrelevantIndex;
+  absentIndex = state.absentIndex;
+}
+
+void Attribute::becomeChild()
+{
+}
+#endif
+
 ostream& operator<<(ostream& out, const Attribute& attribute)
 {
   attribute.printValues(attribute.values.begin(), attribute.values.begin() + attribute.potentialIndex, out);
   return out;
 }
 
-Value* Attribute::createChildValue(const Value& parentValue, const unsigned int newId, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, const vector<Attribute*>::const_iterator parentNextAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd) const
+Value* Attribute::createChildValue(const Value& parentValue, const unsigned int newId, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, const vector<Attribute*>::const_iterator parentNextAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, Arena& arena) const
 {
-  Value* childValue = new Value(parentValue, newId, sizeOfAttributeIt, sizeOfAttributeEnd);
-  vector<vector<unsigned int>>::iterator noiseInIntersectionWithPresentValuesIt = childValue->getIntersectionsBeginWithPresentValues();
-  vector<vector<unsigned int>>::iterator noiseInIntersectionWithPresentAndPotentialValuesIt = childValue->getIntersectionsBeginWithPresentAndPotentialValues();
-  vector<vector<unsigned int>>::const_iterator parentNoiseInIntersectionWithPresentValuesIt = parentValue.getIntersectionsBeginWithPresentValues();
-  vector<vector<unsigned int>>::const_iterator parentNoiseInIntersectionWithPresentAndPotentialValuesIt = parentValue.getIntersectionsBeginWithPresentAndPotentialValues();
+  Value* childValue = arena.create<Value>(parentValue, newId, sizeOfAttributeIt, sizeOfAttributeEnd, arena);
+  Intersections::iterator noiseInIntersectionWithPresentValuesIt = childValue->getIntersectionsBeginWithPresentValues();
+  Intersections::iterator noiseInIntersectionWithPresentAndPotentialValuesIt = childValue->getIntersectionsBeginWithPresentAndPotentialValues();
+  Intersections::const_iterator parentNoiseInIntersectionWithPresentValuesIt = parentValue.getIntersectionsBeginWithPresentValues();
+  Intersections::const_iterator parentNoiseInIntersectionWithPresentAndPotentialValuesIt = parentValue.getIntersectionsBeginWithPresentAndPotentialValues();
   for (vector<Attribute*>::const_iterator attributeIt = parentNextAttributeIt; attributeIt != parentAttributeEnd; ++attributeIt)
     {
       (*attributeIt)->setChildValueIntersections(*parentNoiseInIntersectionWithPresentValuesIt++, *parentNoiseInIntersectionWithPresentAndPotentialValuesIt++, *noiseInIntersectionWithPresentValuesIt++, *noiseInIntersectionWithPresentAndPotentialValuesIt++);
@@ -111,13 +126,13 @@ Value* Attribute::createChildValue(const Value& parentValue, const unsigned int
   return childValue;
 }
 
-void Attribute::setChildValueIntersections(const vector<unsigned int>& noiseInIntersectionWithPresentValues, const vector<unsigned int>& noiseInIntersectionWithPresentAndPotentialValues, vector<unsigned int>& childNoiseInIntersectionWithPresentValues, vector<unsigned int>& childNoiseInIntersectionWithPresentAndPotentialValues) const
+void Attribute::setChildValueIntersections(const unsigned int* noiseInIntersectionWithPresentValues, const unsigned int* noiseInIntersectionWithPresentAndPotentialValues, unsigned int* childNoiseInIntersectionWithPresentValues, unsigned int* childNoiseInIntersectionWithPresentAndPotentialValues) const
 {
   for (const Value* value : values)
     {
       const unsigned int valueIntersectionId = value->getIntersectionId();
-      childNoiseInIntersectionWithPresentValues.push_back(noiseInIntersectionWithPresentValues[valueIntersectionId]);
-      childNoiseInIntersectionWithPresentAndPotentialValues.push_back(noiseInIntersectionWithPresentAndPotentialValues[valueIntersectionId]);
+      *childNoiseInIntersectionWithPresentValues++ = noiseInIntersectionWithPresentValues[valueIntersectionId];
+      *childNoiseInIntersectionWithPresentAndPotentialValues++ = noiseInIntersectionWithPresentAndPotentialValues[valueIntersectionId];
     }
 }
 
@@ -262,14 +277,13 @@ void Attribute::setChosenValueAbsent(const bool isValuePotentiallyPreventingClos
   if (!isClosedVector[id])
 #endif
     {
-      delete lastPotentialValue;
       lastPotentialValue = values.back();
       values.pop_back();
     }
 }
 
 // It should be called after initialization only (values is ordered)
-vector<vector<unsigned int>>::iterator Attribute::getIntersectionsBeginWithPotentialValues(const unsigned int valueId)
+Intersections::iterator Attribute::getIntersectionsBeginWithPotentialValues(const unsigned int valueId)
 {
   return values[valueId]->getIntersectionsBeginWithPresentAndPotentialValues();
 }
@@ -306,6 +320,20 @@ void Attribute::printValues(const vector<Value*>::const_iterator begin, const ve
     }
 }
 
+void Attribute::writePresent(ostream& out) const
+{
+  BinaryPatternFile::writeIds(getPresentDataIds(), out);
+  if (isNoisePrinted)
+    {
+      const vector<Value*>::const_iterator end = values.begin() + potentialIndex;
+      for (vector<Value*>::const_iterator valueIt = values.begin(); valueIt != end; ++valueIt)
+	{
+	  const float noise = static_cast<float>((*valueIt)->getPresentAndPotentialNoise()) / noisePerUnit;
+	  out.write(reinterpret_cast<const char*>(&noise), sizeof(float));
+	}
+    }
+}
+
 void Attribute::printValueFromDataId(const unsigned int valueDataId, ostream& out) const
 {
   out << labelsVector[id][valueDataId];
@@ -545,7 +573,6 @@ vector<unsigned int> Attribute::eraseIrrelevantValues()
   for (vector<Value*>::iterator valueIt = begin; valueIt != end; ++valueIt)
     {
       dataIds.push_back((*valueIt)->getDataId());
-      delete *valueIt;
     }
   values.erase(begin, end);
   absentIndex = irrelevantIndex;
@@ -611,7 +638,6 @@ void Attribute::removeAbsentValue(vector<Value*>::iterator& valueIt)
 #ifdef DEBUG
   cout << labelsVector[id][(*valueIt)->getDataId()] << " in attribute " << internal2ExternalAttributeOrder[id] << " will never extend any future pattern" << endl;
 #endif
-  delete *valueIt;
   *valueIt = values.back();
   values.pop_back();
 }
@@ -693,6 +719,11 @@ void Attribute::printNoise(const float noise, ostream& out)
   out << elementNoiseSeparator << noise;
 }
 
+const vector<string>& Attribute::getLabels(const unsigned int attributeId)
+{
+  return labelsVector[attributeId];
+}
+
 #ifdef ASSERT
 vector<Value*>::const_iterator Attribute::presentBegin() const
 {
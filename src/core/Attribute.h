@@ -16,6 +16,7 @@
 #include <boost/lexical_cast.hpp>
 
 #include "Value.h"
+#include "BinaryPatternFile.h"
 
 #ifdef DEBUG
 #include <iostream>
@@ -46,10 +47,24 @@ class Attribute
   Attribute();
   Attribute(const Attribute& otherAttribute) = delete;
   Attribute(Attribute&& otherAttribute) = delete;
-  Attribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels);
+  Attribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels, Arena& arena);
   virtual ~Attribute();
 
-  virtual Attribute* clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd) const;
+  virtual Attribute* clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena) const;
+
+#ifdef TRAIL
+  struct State
+  {
+    vector<Value*> values;
+    unsigned int potentialIndex;
+    unsigned int irrelevantIndex;
+    unsigned int absentIndex;
+  };
+
+  State getState() const;
+  void setState(State&& state);
+  virtual void becomeChild(); /* to be called after getState, to bring the attribute in the state clone would give its copy */
+#endif
 
   Attribute& operator=(const Attribute& otherAttribute) = delete;
   Attribute& operator=(Attribute&& otherAttribute) = delete;
@@ -83,7 +98,7 @@ class Attribute
   vector<unsigned int> eraseIrrelevantValues(); /* returns the original ids of the erased elements */
 
   // WARNING: These two methods should be called after initialization only (all values ordered in potential)
-  vector<vector<unsigned int>>::iterator getIntersectionsBeginWithPotentialValues(const unsigned int valueId);
+  Intersections::iterator getIntersectionsBeginWithPotentialValues(const unsigned int valueId);
   void substractPotentialNoise(const unsigned int valueId, const unsigned int noise);
 
   const double getAppeal(const vector<Attribute*>::const_iterator attributeBegin, const vector<Attribute*>::const_iterator attributeEnd) const;
@@ -103,6 +118,8 @@ class Attribute
   virtual const bool finalizable() const;
   virtual vector<unsigned int> finalize(); /* returns the original ids of the elements moved to present */
 
+  void writePresent(ostream& out) const;
+
   static const unsigned int lastAttributeId();
   static const vector<unsigned int>& getEpsilonVector();
   static void setIsClosedVector(const vector<bool>& isClosedVector);
@@ -111,6 +128,7 @@ class Attribute
   static void printOutputElementSeparator(ostream& out);
   static void printEmptySetString(ostream& out);
   static void printNoise(const float noise, ostream& out);
+  static const vector<string>& getLabels(const unsigned int attributeId);
 
   static const bool lessAppealingIrrelevant(const Attribute* attribute, const Attribute* otherAttribute);
 
@@ -151,12 +169,12 @@ class Attribute
   static vector<unsigned int> internal2ExternalAttributeOrder;
 #endif
 
-  Attribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd);
+  Attribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena);
 
   void printValues(const vector<Value*>::const_iterator begin, const vector<Value*>::const_iterator end, ostream& out) const;
 
-  Value* createChildValue(const Value& parentValue, const unsigned int newId, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, const vector<Attribute*>::const_iterator parentNextAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd) const;
-  virtual void setChildValueIntersections(const vector<unsigned int>& noiseInIntersectionWithPresentValues, const vector<unsigned int>& noiseInIntersectionWithPresentAndPotentialValues, vector<unsigned int>& childNoiseInIntersectionWithPresentValues, vector<unsigned int>& childNoiseInIntersectionWithPresentAndPotentialValues) const;
+  Value* createChildValue(const Value& parentValue, const unsigned int newId, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, const vector<Attribute*>::const_iterator parentNextAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, Arena& arena) const;
+  virtual void setChildValueIntersections(const unsigned int* noiseInIntersectionWithPresentValues, const unsigned int* noiseInIntersectionWithPresentAndPotentialValues, unsigned int* childNoiseInIntersectionWithPresentValues, unsigned int* childNoiseInIntersectionWithPresentAndPotentialValues) const;
 
   const bool valueDoesNotExtendPresent(const Value& value, const vector<Attribute*>::const_iterator attributeBegin, const vector<Attribute*>::const_iterator attributeEnd) const;
 
@@ -0,0 +1,143 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "BinaryNoisyTupleFile.h"
+
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#include "NoisyTupleFileReader.h"
+
+const char BinaryNoisyTupleFile::magic[8] = {'\x89', 'M', 'D', 'H', '\r', '\n', '\x1a', '\n'};
+
+const bool BinaryNoisyTupleFile::isBinary(const char* begin, const char* end)
+{
+  return static_cast<unsigned long long>(end - begin) >= sizeof(magic) && memcmp(begin, magic, sizeof(magic)) == 0;
+}
+
+const char* BinaryNoisyTupleFile::align(const char* pointer)
+{
+  return pointer + (-reinterpret_cast<unsigned long long>(pointer) & 7);
+}
+
+static void pad(ofstream& binaryFile)
+{
+  static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  binaryFile.write(zeros, -binaryFile.tellp() & 7);
+}
+
+void BinaryNoisyTupleFile::convert(const char* noisyNSetFileName, const char* binaryFileName, const char* inputDimensionSeparator, const char* inputElementSeparator)
+{
+  // Parse
+  NoisyTupleFileReader noisyTupleFileReader(noisyNSetFileName, vector<unsigned int>(), vector<unsigned int>(), inputDimensionSeparator, inputElementSeparator);
+  noisyTupleFileReader.parseRemainingLinesInParallel();
+  vector<unsigned int> tuples;
+  vector<unsigned int> membershipIndices;
+  vector<double> memberships;
+  unordered_map<double, unsigned int> memberships2Indices;
+  for (pair<vector<unsigned int>, double> noisyTuple = noisyTupleFileReader.next(); noisyTuple.second != 0; noisyTuple = noisyTupleFileReader.next())
+    {
+      tuples.insert(tuples.end(), noisyTuple.first.begin(), noisyTuple.first.end());
+      const pair<unordered_map<double, unsigned int>::const_iterator, bool> membership2Index = memberships2Indices.insert(pair<double, unsigned int>(noisyTuple.second, memberships.size()));
+      if (membership2Index.second)
+	{
+	  memberships.push_back(noisyTuple.second);
+	}
+      membershipIndices.push_back(membership2Index.first->second);
+    }
+  const vector<unsigned int> cardinalities = noisyTupleFileReader.getCardinalities();
+  const unsigned int n = cardinalities.size();
+  const unsigned long long nbOfTuples = membershipIndices.size();
+  // Sort the tuples by their first ids with a counting sort, which keeps the order of the file among the tuples with the same first id (the last membership of a repeated tuple prevails)
+  vector<unsigned long long> firstIdEnds;
+  if (n != 0)
+    {
+      firstIdEnds.resize(cardinalities.front() + 1);
+      for (vector<unsigned int>::const_iterator tupleIt = tuples.begin(); tupleIt != tuples.end(); tupleIt += n)
+	{
+	  ++firstIdEnds[*tupleIt + 1];
+	}
+      for (vector<unsigned long long>::iterator firstIdEndIt = firstIdEnds.begin() + 1; firstIdEndIt != firstIdEnds.end(); ++firstIdEndIt)
+	{
+	  *firstIdEndIt += *(firstIdEndIt - 1);
+	}
+    }
+  vector<unsigned int> sortedTuples(tuples.size());
+  vector<unsigned int> sortedMembershipIndices(nbOfTuples);
+  vector<unsigned int>::const_iterator membershipIndexIt = membershipIndices.begin();
+  for (vector<unsigned int>::const_iterator tupleIt = tuples.begin(); tupleIt != tuples.end(); tupleIt += n)
+    {
+      const unsigned long long sortedIndex = firstIdEnds[*tupleIt]++;
+      copy(tupleIt, tupleIt + n, sortedTuples.begin() + sortedIndex * n);
+      sortedMembershipIndices[sortedIndex] = *membershipIndexIt++;
+    }
+  vector<unsigned int>().swap(tuples);
+  vector<unsigned int>().swap(membershipIndices);
+  // Write
+  ofstream binaryFile(binaryFileName, ios::binary);
+  if (!binaryFile)
+    {
+      throw NoFileException(binaryFileName);
+    }
+  Header header;
+  memcpy(header.magic, magic, sizeof(magic));
+  header.n = n;
+  header.membershipIndexSize = 4;
+  if (memberships.size() <= 1 << 16)
+    {
+      header.membershipIndexSize = 2;
+      if (memberships.size() <= 1 << 8)
+	{
+	  header.membershipIndexSize = 1;
+	}
+    }
+  header.nbOfTuples = nbOfTuples;
+  header.nbOfMemberships = memberships.size();
+  binaryFile.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  for (unsigned int dimensionId = 0; dimensionId != n; ++dimensionId)
+    {
+      const vector<string>& labels = noisyTupleFileReader.getIds2Labels(dimensionId);
+      const unsigned long long nbOfLabels = labels.size();
+      binaryFile.write(reinterpret_cast<const char*>(&nbOfLabels), sizeof(unsigned long long));
+      unsigned long long offset = 0;
+      binaryFile.write(reinterpret_cast<const char*>(&offset), sizeof(unsigned long long));
+      for (const string& label : labels)
+	{
+	  offset += label.size();
+	  binaryFile.write(reinterpret_cast<const char*>(&offset), sizeof(unsigned long long));
+	}
+      for (const string& label : labels)
+	{
+	  binaryFile.write(label.data(), label.size());
+	}
+      pad(binaryFile);
+    }
+  binaryFile.write(reinterpret_cast<const char*>(memberships.data()), memberships.size() * sizeof(double));
+  binaryFile.write(reinterpret_cast<const char*>(sortedTuples.data()), sortedTuples.size() * sizeof(unsigned int));
+  pad(binaryFile);
+  vector<char> packedMembershipIndices(nbOfTuples * header.membershipIndexSize);
+  switch (header.membershipIndexSize)
+    {
+    case 1:
+      copy(sortedMembershipIndices.begin(), sortedMembershipIndices.end(), reinterpret_cast<unsigned char*>(packedMembershipIndices.data()));
+      break;
+    case 2:
+      copy(sortedMembershipIndices.begin(), sortedMembershipIndices.end(), reinterpret_cast<unsigned short*>(packedMembershipIndices.data()));
+      break;
+    default:
+      copy(sortedMembershipIndices.begin(), sortedMembershipIndices.end(), reinterpret_cast<unsigned int*>(packedMembershipIndices.data()));
+    }
+  binaryFile.write(packedMembershipIndices.data(), packedMembershipIndices.size());
+  if (!binaryFile)
+    {
+      throw NoFileException(binaryFileName);
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef BINARY_NOISY_TUPLE_FILE_H_
+#define BINARY_NOISY_TUPLE_FILE_H_
+
+#include <vector>
+#include <string>
+
+using namespace std;
+
+/* Binary data file, in the byte order of the machine that wrote it:
+   - the header;
+   - for every dimension, its number of labels, the offsets of the labels (one more than the number of labels) and their concatenation;
+   - the distinct memberships;
+   - the tuples, as n ids each, sorted by their first ids;
+   - for every tuple, the index of its membership on 1, 2 or 4 bytes.
+   Every section starts at a multiple of 8 bytes. */
+class BinaryNoisyTupleFile
+{
+ public:
+  struct Header
+  {
+    char magic[8];
+    unsigned int n;
+    unsigned int membershipIndexSize;
+    unsigned long long nbOfTuples;
+    unsigned long long nbOfMemberships;
+  };
+
+  static const bool isBinary(const char* begin, const char* end);
+  static const char* align(const char* pointer);
+  static void convert(const char* noisyNSetFileName, const char* binaryFileName, const char* inputDimensionSeparator, const char* inputElementSeparator);
+
+ protected:
+  static const char magic[8];
+};
+
+#endif /*BINARY_NOISY_TUPLE_FILE_H_*/
@@ -0,0 +1,58 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "BinaryPatternFile.h"
+
+#include <cstring>
+
+const char BinaryPatternFile::magic[8] = {'\x89', 'M', 'D', 'P', '\r', '\n', '\x1a', '\n'};
+
+void BinaryPatternFile::writeHeader(ostream& out)
+{
+  out.write(magic, sizeof(magic));
+}
+
+void BinaryPatternFile::writeArea(const unsigned long long area, ostream& out)
+{
+  out.write(reinterpret_cast<const char*>(&area), sizeof(unsigned long long));
+}
+
+void BinaryPatternFile::writeIds(const vector<unsigned int>& ids, ostream& out)
+{
+  const unsigned int size = ids.size();
+  out.write(reinterpret_cast<const char*>(&size), sizeof(unsigned int));
+  out.write(reinterpret_cast<const char*>(ids.data()), size * sizeof(unsigned int));
+}
+
+void BinaryPatternFile::writeLabelsAndFooter(const vector<const vector<string>*>& labelsPerDimension, const unsigned long long labelsOffset, const bool isNoiseWritten, ostream& out)
+{
+  for (const vector<string>* labels : labelsPerDimension)
+    {
+      const unsigned long long nbOfLabels = labels->size();
+      out.write(reinterpret_cast<const char*>(&nbOfLabels), sizeof(unsigned long long));
+      unsigned long long offset = 0;
+      out.write(reinterpret_cast<const char*>(&offset), sizeof(unsigned long long));
+      for (const string& label : *labels)
+	{
+	  offset += label.size();
+	  out.write(reinterpret_cast<const char*>(&offset), sizeof(unsigned long long));
+	}
+      for (const string& label : *labels)
+	{
+	  out.write(label.data(), label.size());
+	}
+    }
+  Footer footer;
+  footer.labelsOffset = labelsOffset;
+  footer.n = labelsPerDimension.size();
+  footer.isNoiseWritten = isNoiseWritten;
+  memcpy(footer.magic, magic, sizeof(magic));
+  out.write(reinterpret_cast<const char*>(&footer), sizeof(Footer));
+}
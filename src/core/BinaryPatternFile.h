@@ -0,0 +1,46 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef BINARY_PATTERN_FILE_H_
+#define BINARY_PATTERN_FILE_H_
+
+#include <vector>
+#include <string>
+#include <ostream>
+
+using namespace std;
+
+/* Binary output file, in the byte order of the machine that wrote it:
+   - the magic number;
+   - for every pattern, its area on 8 bytes and, for every dimension, its number of elements on 4 bytes, their ids on 4 bytes each and, if the noise is written, the noise on every element as a float;
+   - for every dimension, its number of labels, the offsets of the labels (one more than the number of labels) and their concatenation, all on 8 bytes, so that the id of an element indexes its label;
+   - the footer.
+   The footer, at the very end of the file, locates the labels and tells how to read the patterns. */
+class BinaryPatternFile
+{
+ public:
+  struct Footer
+  {
+    unsigned long long labelsOffset;
+    unsigned int n;
+    unsigned int isNoiseWritten;
+    char magic[8];
+  };
+
+  static void writeHeader(ostream& out);
+  static void writeArea(const unsigned long long area, ostream& out);
+  static void writeIds(const vector<unsigned int>& ids, ostream& out);
+  static void writeLabelsAndFooter(const vector<const vector<string>*>& labelsPerDimension, const unsigned long long labelsOffset, const bool isNoiseWritten, ostream& out);
+
+ protected:
+  static const char magic[8];
+};
+
+#endif /*BINARY_PATTERN_FILE_H_*/
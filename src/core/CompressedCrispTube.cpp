@@ -0,0 +1,517 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "CompressedCrispTube.h"
+
+CompressedCrispTube::Container::Container(const unsigned int keyParam, const vector<unsigned int>::const_iterator begin, const vector<unsigned int>::const_iterator end): key(keyParam), type(arrayContainer), cardinality(end - begin), lows(), words()
+{
+  unsigned int nbOfRuns = 1;
+  for (vector<unsigned int>::const_iterator idIt = begin; ++idIt != end; )
+    {
+      if (*idIt != *(idIt - 1) + 1)
+	{
+	  ++nbOfRuns;
+	}
+    }
+  // An array container takes 2 bytes per id, a bitmap container 8 kB and a run container 4 bytes per run
+  if (2 * nbOfRuns < cardinality && 4 * nbOfRuns < 8192)
+    {
+      type = runContainer;
+      lows.reserve(2 * nbOfRuns);
+      lows.push_back(*begin);
+      for (vector<unsigned int>::const_iterator idIt = begin; ++idIt != end; )
+	{
+	  if (*idIt != *(idIt - 1) + 1)
+	    {
+	      lows.push_back(*(idIt - 1));
+	      lows.push_back(*idIt);
+	    }
+	}
+      lows.push_back(*(end - 1));
+      return;
+    }
+  if (cardinality > 4096)
+    {
+      type = bitmapContainer;
+      words.resize(1024);
+      for (vector<unsigned int>::const_iterator idIt = begin; idIt != end; ++idIt)
+	{
+	  const unsigned short low = *idIt;
+	  words[low >> 6] |= 1ULL << (low & 63);
+	}
+      return;
+    }
+  lows.reserve(cardinality);
+  for (vector<unsigned int>::const_iterator idIt = begin; idIt != end; ++idIt)
+    {
+      lows.push_back(*idIt);
+    }
+}
+
+const bool CompressedCrispTube::Container::contains(const unsigned short low) const
+{
+  if (type == arrayContainer)
+    {
+      return binary_search(lows.begin(), lows.end(), low);
+    }
+  if (type == bitmapContainer)
+    {
+      return words[low >> 6] >> (low & 63) & 1;
+    }
+  // Find the last run starting at low or before
+  unsigned int firstRun = 0;
+  unsigned int lastRun = lows.size() / 2;
+  while (firstRun != lastRun)
+    {
+      const unsigned int middleRun = (firstRun + lastRun) / 2;
+      if (lows[2 * middleRun] > low)
+	{
+	  lastRun = middleRun;
+	}
+      else
+	{
+	  firstRun = middleRun + 1;
+	}
+    }
+  return firstRun != 0 && lows[2 * firstRun - 1] >= low;
+}
+
+const unsigned int CompressedCrispTube::Container::count(const vector<unsigned int>::const_iterator sortedIdBegin, const vector<unsigned int>::const_iterator sortedIdEnd) const
+{
+  unsigned int nbOfContainedIds = 0;
+  if (type == arrayContainer)
+    {
+      const vector<unsigned short>::const_iterator lowEnd = lows.end();
+      vector<unsigned short>::const_iterator lowIt = lows.begin();
+      for (vector<unsigned int>::const_iterator idIt = sortedIdBegin; idIt != sortedIdEnd && lowIt != lowEnd; ++idIt)
+	{
+	  const unsigned short low = *idIt;
+	  lowIt = gallop(lowIt, lowEnd, low);
+	  if (lowIt != lowEnd && *lowIt == low)
+	    {
+	      ++nbOfContainedIds;
+	    }
+	}
+      return nbOfContainedIds;
+    }
+  for (vector<unsigned int>::const_iterator idIt = sortedIdBegin; idIt != sortedIdEnd; ++idIt)
+    {
+      if (contains(*idIt))
+	{
+	  ++nbOfContainedIds;
+	}
+    }
+  return nbOfContainedIds;
+}
+
+template<typename Function> void CompressedCrispTube::Container::forEach(Function function) const
+{
+  const unsigned int high = key << 16;
+  if (type == arrayContainer)
+    {
+      for (const unsigned short low : lows)
+	{
+	  function(high | low);
+	}
+      return;
+    }
+  if (type == bitmapContainer)
+    {
+      for (unsigned int wordId = 0; wordId != 1024; ++wordId)
+	{
+	  for (unsigned long long word = words[wordId]; word != 0; word &= word - 1)
+	    {
+	      function(high | wordId << 6 | __builtin_ctzll(word));
+	    }
+	}
+      return;
+    }
+  const vector<unsigned short>::const_iterator end = lows.end();
+  for (vector<unsigned short>::const_iterator lowIt = lows.begin(); lowIt != end; lowIt += 2)
+    {
+      for (unsigned int low = *lowIt; low <= *(lowIt + 1); ++low)
+	{
+	  function(high | low);
+	}
+    }
+}
+
+CompressedCrispTube::CompressedCrispTube(const vector<unsigned int>& presentHyperplaneIds) : Tube(compressedCrispTubeData), containers()
+{
+  const vector<unsigned int>::const_iterator end = presentHyperplaneIds.end();
+  vector<unsigned int>::const_iterator containerBegin = presentHyperplaneIds.begin();
+  while (containerBegin != end)
+    {
+      const unsigned int key = *containerBegin >> 16;
+      vector<unsigned int>::const_iterator containerEnd = containerBegin;
+      for (; containerEnd != end && *containerEnd >> 16 == key; ++containerEnd)
+	{
+	}
+      containers.emplace_back(key, containerBegin, containerEnd);
+      containerBegin = containerEnd;
+    }
+}
+
+CompressedCrispTube* CompressedCrispTube::clone() const
+{
+  return new CompressedCrispTube(*this);
+}
+
+void CompressedCrispTube::print(vector<unsigned int>& prefix, ostream& out) const
+{
+  for (const Container& container : containers)
+    {
+      container.forEach([&prefix, &out](const unsigned int hyperplane)
+			{
+			  for (const unsigned int id : prefix)
+			    {
+			      out << id << ' ';
+			    }
+			  out << hyperplane << " 1" << endl;
+			});
+    }
+}
+
+const bool CompressedCrispTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
+{
+  // Never called: the tubes are compressed once every tuple is inserted
+  return false;
+}
+
+const unsigned int CompressedCrispTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId)
+{
+  // Never called
+  return 0;
+}
+
+const unsigned long long CompressedCrispTube::sizeInBytes() const
+{
+  unsigned long long size = sizeof(CompressedCrispTube) + containers.size() * sizeof(Container);
+  for (const Container& container : containers)
+    {
+      size += container.lows.size() * sizeof(unsigned short) + container.words.size() * sizeof(unsigned long long);
+    }
+  return size;
+}
+
+const bool CompressedCrispTube::isPresent(const unsigned int hyperplaneId) const
+{
+  const unsigned int key = hyperplaneId >> 16;
+  if (containers.size() == 1)
+    {
+      return containers.front().key == key && containers.front().contains(hyperplaneId);
+    }
+  const vector<Container>::const_iterator containerIt = lower_bound(containers.begin(), containers.end(), key, [](const Container& container, const unsigned int key) { return container.key < key; });
+  return containerIt != containers.end() && containerIt->key == key && containerIt->contains(hyperplaneId);
+}
+
+const unsigned int CompressedCrispTube::noiseOnValues(const vector<Attribute*>::const_iterator attributeIt, const vector<unsigned int>& valueDataIds) const
+{
+  unsigned int oldNoise = 0;
+  for (const unsigned int valueDataId : valueDataIds)
+    {
+      if (!isPresent(valueDataId))
+	{
+	  oldNoise += Attribute::noisePerUnit;
+	}
+    }
+  return oldNoise;
+}
+
+const unsigned int CompressedCrispTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
+{
+  // *this necessarily relates to the present attribute
+  if (!isPresent((*attributeIt)->getChosenValue().getDataId()))
+    {
+      return Attribute::noisePerUnit;
+    }
+  return 0;
+}
+
+const unsigned int CompressedCrispTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
+{
+  // *this necessarily relates to the present attribute
+  const Value& presentValue = (*attributeIt)->getChosenValue();
+  if (!isPresent(presentValue.getDataId()))
+    {
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()], Attribute::noisePerUnit);
+      return Attribute::noisePerUnit;
+    }
+  return 0;
+}
+
+const unsigned int CompressedCrispTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
+{
+  // *this necessarily relates to the absent attribute
+  return noiseOnValues(absentAttributeIt, absentValueDataIds);
+}
+
+const unsigned int CompressedCrispTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
+{
+  // *this necessarily relates to the absent attribute
+  return noiseOnValues(absentAttributeIt, absentValueDataIds);
+}
+
+const unsigned int CompressedCrispTube::presentFixPresentValuesAfterPresentValueMet(Attribute& currentAttribute) const
+{
+  unsigned int newNoise = 0;
+  const vector<Value*>::iterator end = currentAttribute.presentEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  (*valueIt)->addPresentNoise(Attribute::noisePerUnit);
+	  newNoise += Attribute::noisePerUnit;
+	}
+    }
+  return newNoise;
+}
+
+const unsigned int CompressedCrispTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
+{
+  unsigned int newNoise = 0;
+  const vector<Value*>::iterator end = currentAttribute.presentEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
+	  newNoise += Attribute::noisePerUnit;
+	}
+    }
+  return newNoise;
+}
+
+void CompressedCrispTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  const vector<Value*>::iterator end = currentAttribute.absentEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  (*valueIt)->addPresentNoise(Attribute::noisePerUnit);
+	  const unsigned int valueId = (*valueIt)->getIntersectionId();
+	  for (Intersections::iterator intersectionIt : intersectionIts)
+	    {
+	      Trail::increase((*intersectionIt)[valueId], Attribute::noisePerUnit);
+	    }
+	}
+    }
+}
+
+void CompressedCrispTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  const vector<Value*>::iterator end = currentAttribute.absentEnd();
+  // The first potential value actually is the value set present and there is no noise to be found at the insection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
+  for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); ++valueIt != end; )
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  (*valueIt)->addPresentNoise(Attribute::noisePerUnit);
+	  const unsigned int valueId = (*valueIt)->getIntersectionId();
+	  for (Intersections::iterator intersectionIt : intersectionIts)
+	    {
+	      Trail::increase((*intersectionIt)[valueId], Attribute::noisePerUnit);
+	    }
+	}
+    }
+}
+
+const unsigned int CompressedCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  unsigned int oldNoise = 0;
+  const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
+	  const unsigned int valueId = (*valueIt)->getIntersectionId();
+	  for (Intersections::iterator intersectionIt : intersectionIts)
+	    {
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
+	    }
+	  oldNoise += Attribute::noisePerUnit;
+	}
+    }
+  return oldNoise;
+}
+
+const unsigned int CompressedCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  unsigned int oldNoise = 0;
+  vector<Value*>::iterator end = currentAttribute.presentEnd();
+  vector<Value*>::iterator valueIt = currentAttribute.presentBegin();
+  for (; valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
+	  const unsigned int valueId = (*valueIt)->getIntersectionId();
+	  for (Intersections::iterator intersectionIt : intersectionIts)
+	    {
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
+	    }
+	  oldNoise += Attribute::noisePerUnit;
+	}
+    }
+  end = currentAttribute.irrelevantEnd();
+  while (++valueIt != end)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
+	  const unsigned int valueId = (*valueIt)->getIntersectionId();
+	  for (Intersections::iterator intersectionIt : intersectionIts)
+	    {
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
+	    }
+	  oldNoise += Attribute::noisePerUnit;
+	}
+    }
+  return oldNoise;
+}
+
+const unsigned int CompressedCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
+{
+  unsigned int oldNoise = 0;
+  const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
+	  oldNoise += Attribute::noisePerUnit;
+	}
+    }
+  return oldNoise;
+}
+
+const unsigned int CompressedCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
+{
+  unsigned int oldNoise = 0;
+  vector<Value*>::iterator end = currentAttribute.presentEnd();
+  vector<Value*>::iterator valueIt = currentAttribute.presentBegin();
+  for (; valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
+	  oldNoise += Attribute::noisePerUnit;
+	}
+    }
+  end = currentAttribute.irrelevantEnd();
+  while (++valueIt != end)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
+	  oldNoise += Attribute::noisePerUnit;
+	}
+    }
+  return oldNoise;
+}
+
+void CompressedCrispTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  const vector<Value*>::iterator end = currentAttribute.absentEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
+	  const unsigned int valueId = (*valueIt)->getIntersectionId();
+	  for (Intersections::iterator intersectionIt : intersectionIts)
+	    {
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
+	    }
+	}
+    }
+}
+
+const unsigned int CompressedCrispTube::countNoise(const vector<vector<unsigned int>>::const_iterator dimensionIt) const
+{
+  // The ids in *dimensionIt are sorted: those in a container are merged with it
+  unsigned int nbOfPresentHyperplanes = 0;
+  const vector<unsigned int>::const_iterator idEnd = dimensionIt->end();
+  vector<unsigned int>::const_iterator idIt = dimensionIt->begin();
+  for (const Container& container : containers)
+    {
+      idIt = gallop(idIt, idEnd, container.key << 16);
+      const vector<unsigned int>::const_iterator containerIdEnd = gallop(idIt, idEnd, static_cast<unsigned long long>(container.key + 1) << 16);
+      nbOfPresentHyperplanes += container.count(idIt, containerIdEnd);
+      idIt = containerIdEnd;
+    }
+  return (dimensionIt->size() - nbOfPresentHyperplanes) * Attribute::noisePerUnit;
+}
+
+const bool CompressedCrispTube::decreaseMembershipDownToThreshold(const double membershipThreshold, const vector<vector<unsigned int>>::const_iterator dimensionIt, const vector<vector<unsigned int>::const_iterator>::iterator tupleIt, double& membershipSum) const
+{
+  for (; *tupleIt != dimensionIt->end(); ++*tupleIt)
+    {
+      if (!isPresent(**tupleIt))
+	{
+	  membershipSum -= Attribute::noisePerUnit;
+	  if (membershipSum < membershipThreshold)
+	    {
+	      ++*tupleIt;
+	      return true;
+	    }
+	}
+    }
+  *tupleIt = dimensionIt->begin();
+  return false;
+}
+
+#ifdef ASSERT
+const unsigned int CompressedCrispTube::countNoiseOnPresent(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const
+{
+  if (attributeIt == valueAttributeIt)
+    {
+      if (!isPresent(value.getDataId()))
+	{
+	  return Attribute::noisePerUnit;
+	}
+      return 0;
+    }
+  unsigned int noise = 0;
+  const vector<Value*>::const_iterator end = (*attributeIt)->presentEnd();
+  for (vector<Value*>::const_iterator valueIt = (*attributeIt)->presentBegin(); valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  noise += Attribute::noisePerUnit;
+	}
+    }
+  return noise;
+}
+
+const unsigned int CompressedCrispTube::countNoiseOnPresentAndPotential(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const
+{
+  if (attributeIt == valueAttributeIt)
+    {
+      if (!isPresent(value.getDataId()))
+	{
+	  return Attribute::noisePerUnit;
+	}
+      return 0;
+    }
+  unsigned int noise = 0;
+  vector<Value*>::const_iterator end = (*attributeIt)->irrelevantEnd();
+  for (vector<Value*>::const_iterator valueIt = (*attributeIt)->presentBegin(); valueIt != end; ++valueIt)
+    {
+      if (!isPresent((*valueIt)->getDataId()))
+	{
+	  noise += Attribute::noisePerUnit;
+	}
+    }
+  return noise;
+}
+#endif
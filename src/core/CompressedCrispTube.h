@@ -0,0 +1,80 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef COMPRESSED_CRISP_TUBE_H_
+#define COMPRESSED_CRISP_TUBE_H_
+
+#include "../utilities/gallop.h"
+#include "Tube.h"
+
+/* Roaring-style tube: the present hyperplane ids are split by their 16 high bits into containers, each of which is a sorted array of the 16 low bits, a bitmap or a sorted list of runs, whichever is the smallest */
+class CompressedCrispTube final: public Tube<CompressedCrispTube>
+{
+  friend class Tube<CompressedCrispTube>;
+
+ public:
+  CompressedCrispTube(const vector<unsigned int>& presentHyperplaneIds); /* presentHyperplaneIds must be sorted */
+
+  void print(vector<unsigned int>& prefix, ostream& out) const;
+  const bool setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts);
+  const unsigned int setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId);
+
+  const unsigned int setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const;
+  const unsigned int setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const;
+  const unsigned int setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const;
+  const unsigned int setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const;
+
+  const unsigned int countNoise(const vector<vector<unsigned int>>::const_iterator dimensionIt) const;
+  const bool decreaseMembershipDownToThreshold(const double membershipThreshold, const vector<vector<unsigned int>>::const_iterator dimensionIt, const vector<vector<unsigned int>::const_iterator>::iterator tupleIt, double& membershipSum) const;
+
+#ifdef ASSERT
+  const unsigned int countNoiseOnPresent(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const;
+  const unsigned int countNoiseOnPresentAndPotential(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const;
+#endif
+
+  const unsigned long long sizeInBytes() const;
+
+ protected:
+  enum ContainerType { arrayContainer, bitmapContainer, runContainer };
+
+  struct Container
+  {
+    unsigned int key;
+    ContainerType type;
+    unsigned int cardinality;
+    vector<unsigned short> lows; /* the sorted low bits in an array container; the first and the last low bits of every run in a run container */
+    vector<unsigned long long> words; /* the 1024 words of a bitmap container */
+
+    Container(const unsigned int key, const vector<unsigned int>::const_iterator begin, const vector<unsigned int>::const_iterator end);
+
+    const bool contains(const unsigned short low) const;
+    const unsigned int count(const vector<unsigned int>::const_iterator sortedIdBegin, const vector<unsigned int>::const_iterator sortedIdEnd) const;
+    template<typename Function> void forEach(Function function) const;
+  };
+
+  vector<Container> containers;
+
+  CompressedCrispTube* clone() const;
+
+  const bool isPresent(const unsigned int hyperplaneId) const;
+  const unsigned int noiseOnValues(const vector<Attribute*>::const_iterator attributeIt, const vector<unsigned int>& valueDataIds) const;
+
+  const unsigned int presentFixPresentValuesAfterPresentValueMet(Attribute& currentAttribute) const;
+  const unsigned int presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const;
+  void presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const;
+  void presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const;
+  const unsigned int absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const;
+  const unsigned int absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const;
+  const unsigned int absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const;
+  const unsigned int absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const;
+  void absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const;
+};
+
+#endif /*COMPRESSED_CRISP_TUBE_H_*/
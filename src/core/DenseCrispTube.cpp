@@ -10,7 +10,11 @@
 
 #include "DenseCrispTube.h"
 
-DenseCrispTube::DenseCrispTube(const SparseCrispTube& sparseCrispTube, const unsigned int nbOfHyperplanes) : tube()
+thread_local const vector<unsigned int>* DenseCrispTube::maskedValueDataIds = nullptr;
+thread_local dynamic_bitset<> DenseCrispTube::valueMask;
+thread_local dynamic_bitset<> DenseCrispTube::noisyValues;
+
+DenseCrispTube::DenseCrispTube(const SparseCrispTube& sparseCrispTube, const unsigned int nbOfHyperplanes) : Tube(denseCrispTubeData), tube()
 {
   tube.resize(nbOfHyperplanes, true);
   const unordered_set<unsigned int>& sparseTube = sparseCrispTube.getTube();
@@ -20,6 +24,11 @@ DenseCrispTube::DenseCrispTube(const SparseCrispTube& sparseCrispTube, const uns
     }
 }
 
+void DenseCrispTube::forgetValueMask()
+{
+  maskedValueDataIds = nullptr;
+}
+
 DenseCrispTube* DenseCrispTube::clone() const
 {
   return new DenseCrispTube(*this);
@@ -42,19 +51,41 @@ void DenseCrispTube::print(vector<unsigned int>& prefix, ostream& out) const
     }
 }
 
-const bool DenseCrispTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts)
+AbstractData* DenseCrispTube::compress()
+{
+#ifdef COMPRESSED_TUBES
+  vector<unsigned int> presentHyperplaneIds;
+  presentHyperplaneIds.reserve(tube.size() - tube.count());
+  for (dynamic_bitset<>::size_type hyperplaneId = 0; hyperplaneId != tube.size(); ++hyperplaneId)
+    {
+      if (!tube[hyperplaneId])
+	{
+	  presentHyperplaneIds.push_back(hyperplaneId);
+	}
+    }
+  CompressedCrispTube* compressedTube = new CompressedCrispTube(presentHyperplaneIds);
+  if (compressedTube->sizeInBytes() < sizeof(DenseCrispTube) + tube.num_blocks() * sizeof(dynamic_bitset<>::block_type))
+    {
+      return compressedTube;
+    }
+  delete compressedTube;
+#endif
+  return this;
+}
+
+const bool DenseCrispTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
 {
   const unsigned int element = oldIds2NewIdsIt->at(tuple[*attributeIdIt]);
   (*attributeIt)->substractPotentialNoise(element, Attribute::noisePerUnit);
-  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+  for (Intersections::iterator intersectionIt : intersectionIts)
     {
-      (*intersectionIt)[element] -= Attribute::noisePerUnit;
+      Trail::decrease((*intersectionIt)[element], Attribute::noisePerUnit);
     }
   tube.set(element, false);
   return false;
 }
 
-const unsigned int DenseCrispTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, const unsigned int dimensionId)
+const unsigned int DenseCrispTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId)
 {
   // Never called
   return 0;
@@ -62,18 +93,40 @@ const unsigned int DenseCrispTube::setSelfLoopsInSymmetricAttribute(const unsign
 
 const unsigned int DenseCrispTube::noiseOnValues(const vector<Attribute*>::const_iterator attributeIt, const vector<unsigned int>& valueDataIds) const
 {
-  unsigned int oldNoise = 0;
+  return noiseOnValues(valueDataIds);
+}
+
+const unsigned int DenseCrispTube::noiseOnValues(const vector<unsigned int>& valueDataIds) const
+{
+  if (valueDataIds.size() > 2 * tube.num_blocks())
+    {
+      // The same values are usually looked up in many tubes: they are masked once and the noise is counted word by word
+      if (maskedValueDataIds != &valueDataIds || valueMask.size() != tube.size())
+	{
+	  valueMask.reset();
+	  valueMask.resize(tube.size());
+	  for (const unsigned int valueDataId : valueDataIds)
+	    {
+	      valueMask.set(valueDataId);
+	    }
+	  maskedValueDataIds = &valueDataIds;
+	}
+      noisyValues = tube;
+      noisyValues &= valueMask;
+      return noisyValues.count() * Attribute::noisePerUnit;
+    }
+  unsigned int noise = 0;
   for (const unsigned int valueDataId : valueDataIds)
     {
       if (tube[valueDataId])
 	{
-	  oldNoise += Attribute::noisePerUnit;
+	  noise += Attribute::noisePerUnit;
 	}
     }
-  return oldNoise;
+  return noise;
 }
 
-const unsigned int DenseCrispTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int DenseCrispTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the present attribute
   if (tube[(*attributeIt)->getChosenValue().getDataId()])
@@ -83,25 +136,25 @@ const unsigned int DenseCrispTube::setPresent(const vector<Attribute*>::iterator
   return 0;
 }
 
-const unsigned int DenseCrispTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int DenseCrispTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   // *this necessarily relates to the present attribute
   const Value& presentValue = (*attributeIt)->getChosenValue();
   if (tube[presentValue.getDataId()])
     {
-      (*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()] += Attribute::noisePerUnit;
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()], Attribute::noisePerUnit);
       return Attribute::noisePerUnit;
     }
   return 0;
 }
 
-const unsigned int DenseCrispTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int DenseCrispTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the absent attribute
   return noiseOnValues(absentAttributeIt, absentValueDataIds);
 }
 
-const unsigned int DenseCrispTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int DenseCrispTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
   // *this necessarily relates to the absent attribute
   return noiseOnValues(absentAttributeIt, absentValueDataIds);
@@ -122,7 +175,7 @@ const unsigned int DenseCrispTube::presentFixPresentValuesAfterPresentValueMet(A
   return newNoise;
 }
 
-const unsigned int DenseCrispTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int DenseCrispTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -130,14 +183,14 @@ const unsigned int DenseCrispTube::presentFixPresentValuesAfterPresentValueMetAn
     {
       if (tube[(*valueIt)->getDataId()])
 	{
-	  (*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()] += Attribute::noisePerUnit;
+	  Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
 	  newNoise += Attribute::noisePerUnit;
 	}
     }
   return newNoise;
 }
 
-void DenseCrispTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void DenseCrispTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
@@ -146,15 +199,15 @@ void DenseCrispTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attri
 	{
 	  (*valueIt)->addPresentNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] += Attribute::noisePerUnit;
+	      Trail::increase((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	}
     }
 }
 
-void DenseCrispTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void DenseCrispTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   // The first potential value actually is the value set present and there is no noise to be found at the insection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
@@ -164,15 +217,15 @@ void DenseCrispTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute
 	{
 	  (*valueIt)->addPresentNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] += Attribute::noisePerUnit;
+	      Trail::increase((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	}
     }
 }
 
-const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
@@ -182,9 +235,9 @@ const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentV
 	{
 	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] -= Attribute::noisePerUnit;
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	  oldNoise += Attribute::noisePerUnit;
 	}
@@ -192,7 +245,7 @@ const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentV
   return oldNoise;
 }
 
-const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -203,9 +256,9 @@ const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymm
 	{
 	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] -= Attribute::noisePerUnit;
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	  oldNoise += Attribute::noisePerUnit;
 	}
@@ -218,9 +271,9 @@ const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymm
 	{
 	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] -= Attribute::noisePerUnit;
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	  oldNoise += Attribute::noisePerUnit;
 	}
@@ -228,7 +281,7 @@ const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymm
   return oldNoise;
 }
 
-const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
@@ -236,14 +289,14 @@ const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentV
     {
       if (tube[(*valueIt)->getDataId()])
 	{
-	  (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= Attribute::noisePerUnit;
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
 	  oldNoise += Attribute::noisePerUnit;
 	}
     }
   return oldNoise;
 }
 
-const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -252,7 +305,7 @@ const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymm
     {
       if (tube[(*valueIt)->getDataId()])
 	{
-	  (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= Attribute::noisePerUnit;
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
 	  oldNoise += Attribute::noisePerUnit;
 	}
     }
@@ -261,14 +314,14 @@ const unsigned int DenseCrispTube::absentFixPresentOrPotentialValuesInSecondSymm
     {
       if (tube[(*valueIt)->getDataId()])
 	{
-	  (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= Attribute::noisePerUnit;
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
 	  oldNoise += Attribute::noisePerUnit;
 	}
     }
   return oldNoise;
 }
 
-void DenseCrispTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void DenseCrispTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
@@ -277,9 +330,9 @@ void DenseCrispTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& curren
 	{
 	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] -= Attribute::noisePerUnit;
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	}
     }
@@ -287,19 +340,34 @@ void DenseCrispTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& curren
 
 const unsigned int DenseCrispTube::countNoise(const vector<vector<unsigned int>>::const_iterator dimensionIt) const
 {
+  return noiseOnValues(*dimensionIt);
+}
+
+const bool DenseCrispTube::decreaseMembershipDownToThreshold(const double membershipThreshold, const vector<vector<unsigned int>>::const_iterator dimensionIt, const vector<vector<unsigned int>::const_iterator>::iterator tupleIt, double& membershipSum) const
+{
+  // The noise on the remaining values is counted at once (word by word if they are all the values of the dimension and many): the values are looked up one by one only if the threshold is crossed in this tube
   unsigned int noise = 0;
-  for (const unsigned int id : *dimensionIt)
+  if (*tupleIt == dimensionIt->begin())
+    {
+      noise = noiseOnValues(*dimensionIt);
+    }
+  else
     {
-      if (tube[id])
+      const vector<unsigned int>::const_iterator end = dimensionIt->end();
+      for (vector<unsigned int>::const_iterator idIt = *tupleIt; idIt != end; ++idIt)
 	{
-	  noise += Attribute::noisePerUnit;
+	  if (tube[*idIt])
+	    {
+	      noise += Attribute::noisePerUnit;
+	    }
 	}
     }
-  return noise;
-}
-
-const bool DenseCrispTube::decreaseMembershipDownToThreshold(const double membershipThreshold, const vector<vector<unsigned int>>::const_iterator dimensionIt, const vector<vector<unsigned int>::const_iterator>::iterator tupleIt, double& membershipSum) const
-{
+  if (!(membershipSum - noise < membershipThreshold))
+    {
+      membershipSum -= noise;
+      *tupleIt = dimensionIt->begin();
+      return false;
+    }
   for (; *tupleIt != dimensionIt->end(); ++*tupleIt)
     {
       if (tube[**tupleIt])
@@ -10,25 +10,33 @@
 
 #include "DenseFuzzyTube.h"
 
-DenseFuzzyTube::DenseFuzzyTube(const SparseFuzzyTube& sparseFuzzyTube, const unsigned int nbOfHyperplanes) : tube()
+template<typename T> unsigned int DenseFuzzyTube<T>::noiseQuantum = 1;
+
+template<typename T> DenseFuzzyTube<T>::DenseFuzzyTube(const SparseFuzzyTube& sparseFuzzyTube, const unsigned int nbOfHyperplanes) : Tube<DenseFuzzyTube<T>>(sizeof(T) == 1 ? AbstractData::denseFuzzyTube8Data : sizeof(T) == 2 ? AbstractData::denseFuzzyTube16Data : AbstractData::denseFuzzyTube32Data), tube()
 {
   tube.reserve(nbOfHyperplanes);
   for (unsigned int hyperplaneId = 0; hyperplaneId != nbOfHyperplanes; ++hyperplaneId)
     {
-      tube.push_back(sparseFuzzyTube.noiseOnValue(hyperplaneId));
+      tube.push_back(sparseFuzzyTube.noiseOnValue(hyperplaneId) / noiseQuantum);
     }
 }
 
-DenseFuzzyTube* DenseFuzzyTube::clone() const
+template<typename T> void DenseFuzzyTube<T>::setNoiseQuantum(const unsigned int noiseQuantumParam)
+{
+  noiseQuantum = noiseQuantumParam;
+}
+
+template<typename T> DenseFuzzyTube<T>* DenseFuzzyTube<T>::clone() const
 {
   return new DenseFuzzyTube(*this);
 }
 
-void DenseFuzzyTube::print(vector<unsigned int>& prefix, ostream& out) const
+template<typename T> void DenseFuzzyTube<T>::print(vector<unsigned int>& prefix, ostream& out) const
 {
   unsigned int hyperplaneId = 0;
-  for (const unsigned int noise : tube)
+  for (const T quantizedNoise : tube)
     {
+      const unsigned int noise = quantizedNoise * noiseQuantum;
       if (noise != Attribute::noisePerUnit)
 	{
 	  for (const unsigned int id : prefix)
@@ -41,231 +49,246 @@ void DenseFuzzyTube::print(vector<unsigned int>& prefix, ostream& out) const
     }
 }
 
-const bool DenseFuzzyTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts)
+template<typename T> const bool DenseFuzzyTube<T>::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
 {
   const unsigned int element = oldIds2NewIdsIt->at(tuple[*attributeIdIt]);
   (*attributeIt)->substractPotentialNoise(element, membership);
-  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+  for (Intersections::iterator intersectionIt : intersectionIts)
     {
-      (*intersectionIt)[element] -= membership;
+      Trail::decrease((*intersectionIt)[element], membership);
     }
-  tube[element] = Attribute::noisePerUnit - membership;
+  tube[element] = (Attribute::noisePerUnit - membership) / noiseQuantum;
   return false;
 }
 
-const unsigned int DenseFuzzyTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, const unsigned int dimensionId)
+template<typename T> const unsigned int DenseFuzzyTube<T>::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId)
 {
   // Never called
   return 0;
 }
 
-const unsigned int DenseFuzzyTube::noiseOnValues(const vector<Attribute*>::const_iterator attributeIt, const vector<unsigned int>& valueDataIds) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::noiseOnValue(const unsigned int valueDataId) const
 {
-  unsigned int oldNoise = 0;
-  for (const unsigned int valueDataId : valueDataIds)
+  return tube[valueDataId] * noiseQuantum;
+}
+
+template<typename T> const unsigned int DenseFuzzyTube<T>::noiseOnValues(const vector<Attribute*>::const_iterator attributeIt, const vector<unsigned int>& valueDataIds) const
+{
+  return noiseOnValues(valueDataIds.begin(), valueDataIds.end());
+}
+
+template<typename T> const unsigned int DenseFuzzyTube<T>::noiseOnValues(const vector<unsigned int>::const_iterator valueDataIdBegin, const vector<unsigned int>::const_iterator valueDataIdEnd) const
+{
+  // Gather the stored noises and multiply their sum by noiseQuantum once
+  const T* noises = tube.data();
+  unsigned int noise = 0;
+  for (vector<unsigned int>::const_iterator valueDataIdIt = valueDataIdBegin; valueDataIdIt != valueDataIdEnd; ++valueDataIdIt)
     {
-      oldNoise += tube[valueDataId];
+      noise += noises[*valueDataIdIt];
     }
-  return oldNoise;
+  return noise * noiseQuantum;
 }
 
-const unsigned int DenseFuzzyTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the present attribute
-  return tube[(*attributeIt)->getChosenValue().getDataId()];
+  return noiseOnValue((*attributeIt)->getChosenValue().getDataId());
 }
 
-const unsigned int DenseFuzzyTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   // *this necessarily relates to the present attribute
   const Value& presentValue = (*attributeIt)->getChosenValue();
-  const unsigned int noise = tube[presentValue.getDataId()];
-  (*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()] += noise;
+  const unsigned int noise = noiseOnValue(presentValue.getDataId());
+  Trail::increase((*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()], noise);
   return noise;
 }
 
-const unsigned int DenseFuzzyTube::presentFixPresentValuesAfterPresentValueMet(Attribute& currentAttribute) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::presentFixPresentValuesAfterPresentValueMet(Attribute& currentAttribute) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int newNoiseInHyperplane = tube[(*valueIt)->getDataId()];
+      const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       newNoise += newNoiseInHyperplane;
     }
   return newNoise;
 }
 
-const unsigned int DenseFuzzyTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int newNoiseInHyperplane = tube[(*valueIt)->getDataId()];
-      (*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()] += newNoiseInHyperplane;
+      const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], newNoiseInHyperplane);
       newNoise += newNoiseInHyperplane;
     }
   return newNoise;
 }
 
-void DenseFuzzyTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> void DenseFuzzyTube<T>::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int newNoiseInHyperplane = tube[(*valueIt)->getDataId()];
+      const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-void DenseFuzzyTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> void DenseFuzzyTube<T>::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   // The first potential value actually is the value set present and there is no noise to be found at the insection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); ++valueIt != end; )
     {
-      const unsigned int newNoiseInHyperplane = tube[(*valueIt)->getDataId()];
+      const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-const unsigned int DenseFuzzyTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the absent attribute
   return noiseOnValues(absentAttributeIt, absentValueDataIds);
 }
 
-const unsigned int DenseFuzzyTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
   // *this necessarily relates to the absent attribute
   return noiseOnValues(absentAttributeIt, absentValueDataIds);
 }
 
-const unsigned int DenseFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = tube[(*valueIt)->getDataId()];
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int DenseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
   vector<Value*>::iterator valueIt = currentAttribute.presentBegin();
   for (; valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = tube[(*valueIt)->getDataId()];
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   end = currentAttribute.irrelevantEnd();
   while (++valueIt != end)  
     {
-      const unsigned int oldNoiseInHyperplane = tube[(*valueIt)->getDataId()];
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int DenseFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = tube[(*valueIt)->getDataId()];
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int DenseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
   vector<Value*>::iterator valueIt = currentAttribute.presentBegin();
   for (; valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = tube[(*valueIt)->getDataId()];
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   end = currentAttribute.irrelevantEnd();
   while (++valueIt != end)
     {
-      const unsigned int oldNoiseInHyperplane = tube[(*valueIt)->getDataId()];
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-void DenseFuzzyTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> void DenseFuzzyTube<T>::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = tube[(*valueIt)->getDataId()];
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
     }
 }
 
-const unsigned int DenseFuzzyTube::countNoise(const vector<vector<unsigned int>>::const_iterator dimensionIt) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::countNoise(const vector<vector<unsigned int>>::const_iterator dimensionIt) const
 {
-  unsigned int noise = 0;
-  for (const unsigned int id : *dimensionIt)
-    {
-      noise += tube[id];
-    }
-  return noise;
+  return noiseOnValues(dimensionIt->begin(), dimensionIt->end());
 }
 
-const bool DenseFuzzyTube::decreaseMembershipDownToThreshold(const double membershipThreshold, const vector<vector<unsigned int>>::const_iterator dimensionIt, const vector<vector<unsigned int>::const_iterator>::iterator tupleIt, double& membershipSum) const
+template<typename T> const bool DenseFuzzyTube<T>::decreaseMembershipDownToThreshold(const double membershipThreshold, const vector<vector<unsigned int>>::const_iterator dimensionIt, const vector<vector<unsigned int>::const_iterator>::iterator tupleIt, double& membershipSum) const
 {
+  // The noise on the remaining values is gathered at once: the values are looked up one by one only if the threshold is crossed in this tube
+  const unsigned int noise = noiseOnValues(*tupleIt, dimensionIt->end());
+  if (!(membershipSum - noise < membershipThreshold))
+    {
+      membershipSum -= noise;
+      *tupleIt = dimensionIt->begin();
+      return false;
+    }
   for (; *tupleIt != dimensionIt->end(); ++*tupleIt)
     {
-      membershipSum -=tube[**tupleIt];
+      membershipSum -= noiseOnValue(**tupleIt);
       if (membershipSum < membershipThreshold)
 	{
 	  ++*tupleIt;
@@ -277,33 +300,37 @@ const bool DenseFuzzyTube::decreaseMembershipDownToThreshold(const double member
 }
 
 #ifdef ASSERT
-const unsigned int DenseFuzzyTube::countNoiseOnPresent(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::countNoiseOnPresent(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const
 {
   if (attributeIt == valueAttributeIt)
     {
-      return tube[value.getDataId()];
+      return noiseOnValue(value.getDataId());
     }
   unsigned int noise = 0;
   const vector<Value*>::const_iterator end = (*attributeIt)->presentEnd();
   for (vector<Value*>::const_iterator valueIt = (*attributeIt)->presentBegin(); valueIt != end; ++valueIt)
     {
-      noise += tube[(*valueIt)->getDataId()];
+      noise += noiseOnValue((*valueIt)->getDataId());
     }
   return noise;
 }
 
-const unsigned int DenseFuzzyTube::countNoiseOnPresentAndPotential(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const
+template<typename T> const unsigned int DenseFuzzyTube<T>::countNoiseOnPresentAndPotential(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const
 {
   if (attributeIt == valueAttributeIt)
     {
-      return tube[value.getDataId()];
+      return noiseOnValue(value.getDataId());
     }
   unsigned int noise = 0;
   vector<Value*>::const_iterator end = (*attributeIt)->irrelevantEnd();
   for (vector<Value*>::const_iterator valueIt = (*attributeIt)->presentBegin(); valueIt != end; ++valueIt)
     {
-      noise += tube[(*valueIt)->getDataId()];
+      noise += noiseOnValue((*valueIt)->getDataId());
     }
   return noise;
 }
 #endif
+
+template class DenseFuzzyTube<unsigned char>;
+template class DenseFuzzyTube<unsigned short>;
+template class DenseFuzzyTube<unsigned int>;
@@ -13,7 +13,7 @@
 vector<double> MetricAttribute::tauVector;
 vector<vector<double>> MetricAttribute::timestampsVector;
 
-MetricAttribute::MetricAttribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels, const double tau): Attribute(nbOfValuesPerAttribute, epsilon, labels)
+MetricAttribute::MetricAttribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels, const double tau, Arena& arena): Attribute(nbOfValuesPerAttribute, epsilon, labels, arena)
 {
   tauVector.resize(id + 1);
   tauVector.back() = tau;
@@ -26,7 +26,7 @@ MetricAttribute::MetricAttribute(const vector<unsigned int>& nbOfValuesPerAttrib
     }
 }
 
-MetricAttribute::MetricAttribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd): Attribute()
+MetricAttribute::MetricAttribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena): Attribute()
 {
   const MetricAttribute& parentMetricAttribute = static_cast<MetricAttribute&>(**parentAttributeIt);
   id = parentMetricAttribute.id;
@@ -48,11 +48,11 @@ MetricAttribute::MetricAttribute(const vector<Attribute*>::const_iterator parent
 	{
 	  if (potentialValueIt == potentialEnd || (absentValueIt != absentEnd && (*absentValueIt)->getDataId() < (*potentialValueIt)->getDataId()))
 	    {
-	      values[absentIndex++] = createChildValue(**absentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+	      values[absentIndex++] = createChildValue(**absentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 	    }
 	  else
 	    {
-	      values[potentialIndex++] = createChildValue(**potentialValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+	      values[potentialIndex++] = createChildValue(**potentialValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 	    }
 	}
       else
@@ -61,11 +61,11 @@ MetricAttribute::MetricAttribute(const vector<Attribute*>::const_iterator parent
 	    {
 	      if (absentValueIt == absentEnd || (*absentValueIt)->getDataId() > (*presentValueIt)->getDataId())
 		{
-		  values[presentIndex++] = createChildValue(**presentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+		  values[presentIndex++] = createChildValue(**presentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 		}
 	      else
 		{
-		  values[absentIndex++] = createChildValue(**absentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+		  values[absentIndex++] = createChildValue(**absentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 		}
 	    }
 	  else
@@ -74,11 +74,11 @@ MetricAttribute::MetricAttribute(const vector<Attribute*>::const_iterator parent
 		{
 		  if ((*potentialValueIt)->getDataId() < (*presentValueIt)->getDataId())
 		    {
-		      values[potentialIndex++] = createChildValue(**potentialValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+		      values[potentialIndex++] = createChildValue(**potentialValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 		    }
 		  else
 		    {
-		      values[presentIndex++] = createChildValue(**presentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+		      values[presentIndex++] = createChildValue(**presentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 		    }
 		}
 	      else
@@ -87,22 +87,22 @@ MetricAttribute::MetricAttribute(const vector<Attribute*>::const_iterator parent
 		    {
 		      if ((*absentValueIt)->getDataId() < (*presentValueIt)->getDataId())
 			{
-			  values[absentIndex++] = createChildValue(**absentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+			  values[absentIndex++] = createChildValue(**absentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 			}
 		      else
 			{
-			  values[presentIndex++] = createChildValue(**presentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+			  values[presentIndex++] = createChildValue(**presentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 			}
 		    }
 		  else
 		    {
 		      if ((*potentialValueIt)->getDataId() < (*presentValueIt)->getDataId())
 			{
-			  values[potentialIndex++] = createChildValue(**potentialValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+			  values[potentialIndex++] = createChildValue(**potentialValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 			}
 		      else
 			{
-			  values[presentIndex++] = createChildValue(**presentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd);
+			  values[presentIndex++] = createChildValue(**presentValueIt++, newId++, sizeOfAttributeIt, sizeOfAttributeEnd, parentNextAttributeIt, parentAttributeEnd, arena);
 			}
 		    }
 		}
@@ -113,12 +113,12 @@ MetricAttribute::MetricAttribute(const vector<Attribute*>::const_iterator parent
   absentIndex = parentMetricAttribute.absentIndex;
 }
 
-MetricAttribute* MetricAttribute::clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd) const
+MetricAttribute* MetricAttribute::clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena) const
 {
-  return new MetricAttribute(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt, sizeOfAttributeEnd);
+  return new (arena.allocate(sizeof(MetricAttribute), alignof(MetricAttribute))) MetricAttribute(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt, sizeOfAttributeEnd, arena);
 }
 
-void MetricAttribute::setChildValueIntersections(const vector<unsigned int>& noiseInIntersectionWithPresentValues, const vector<unsigned int>& noiseInIntersectionWithPresentAndPotentialValues, vector<unsigned int>& childNoiseInIntersectionWithPresentValues, vector<unsigned int>& childNoiseInIntersectionWithPresentAndPotentialValues) const
+void MetricAttribute::setChildValueIntersections(const unsigned int* noiseInIntersectionWithPresentValues, const unsigned int* noiseInIntersectionWithPresentAndPotentialValues, unsigned int* childNoiseInIntersectionWithPresentValues, unsigned int* childNoiseInIntersectionWithPresentAndPotentialValues) const
 {
   vector<Value*>::const_iterator presentValueIt = values.begin();
   vector<Value*>::const_iterator potentialValueIt = presentValueIt + potentialIndex;
@@ -193,11 +193,19 @@ void MetricAttribute::setChildValueIntersections(const vector<unsigned int>& noi
 		}
 	    }
 	}
-      childNoiseInIntersectionWithPresentValues.push_back(noiseInIntersectionWithPresentValues[valueId]);
-      childNoiseInIntersectionWithPresentAndPotentialValues.push_back(noiseInIntersectionWithPresentAndPotentialValues[valueId]);
+      *childNoiseInIntersectionWithPresentValues++ = noiseInIntersectionWithPresentValues[valueId];
+      *childNoiseInIntersectionWithPresentAndPotentialValues++ = noiseInIntersectionWithPresentAndPotentialValues[valueId];
     }
 }
 
+#ifdef TRAIL
+void MetricAttribute::becomeChild()
+{
+  // Like the copy constructor, which does not take over the index of the irrelevant values
+  irrelevantIndex = 0;
+}
+#endif
+
 void MetricAttribute::chooseValue()
 {
   const vector<Value*>::iterator potentialBegin = values.begin() + potentialIndex;
@@ -260,7 +268,6 @@ void MetricAttribute::setChosenValueAbsent(const bool isValuePotentiallyPreventi
       rotate(valueIt - 1, valueIt, values.end());
       return;
     }
-  delete chosenValue;
   values.erase(chosenValueIt);
   --absentIndex;
 }
@@ -555,7 +562,6 @@ void MetricAttribute::eraseAbsentValuesBeneathTimestamp(const double timestamp)
   const vector<Value*>::iterator absentBegin = valueIt;
   for (; valueIt != values.end() && timestamps[(*valueIt)->getDataId()] < timestamp; ++valueIt)
     {
-      delete *valueIt;
     }
   values.erase(absentBegin, valueIt);
 }
@@ -571,17 +577,12 @@ void MetricAttribute::eraseAbsentValuesBeyondTimestamp(const double timestamp)
       vector<Value*>::iterator absentBegin = values.begin() + absentIndex;
       if (timestamps[(*absentBegin)->getDataId()] > timestamp)
 	{
-	  for (vector<Value*>::iterator valueIt = absentBegin; valueIt != values.end(); ++valueIt)
-	    {
-	      delete *valueIt;
-	    }
 	  values.resize(absentIndex);
 	  return;
 	}
       vector<Value*>::iterator valueIt = --(values.end());
       for (; timestamps[(*valueIt)->getDataId()] > timestamp; --valueIt)
 	{
-	  delete *valueIt;
 	}
       values.erase(valueIt + 1, values.end());
     }
@@ -634,7 +635,6 @@ void MetricAttribute::removeAbsentValue(vector<Value*>::iterator& valueIt)
 #ifdef DEBUG
   cout << labelsVector[id][(*valueIt)->getDataId()] << " in attribute " << internal2ExternalAttributeOrder[id] << " will never extend any future pattern" << endl;
 #endif
-  delete *valueIt;
   valueIt = values.erase(valueIt);
 }
 
@@ -683,7 +683,6 @@ pair<const bool, vector<unsigned int>> MetricAttribute::tauFarValueDataIdsAndChe
 	  for (vector<Value*>::iterator tauFarPotentialValueIt = potentialBegin; tauFarPotentialValueIt != lowerPotentialBorderIt; ++tauFarPotentialValueIt)
 	    {
 	      irrelevantValueDataIds.push_back((*tauFarPotentialValueIt)->getDataId());
-	      delete *tauFarPotentialValueIt;
 	    }
 	  const unsigned int nbOfValueBeforeErasure = values.size();
 	  values.erase(potentialBegin, lowerPotentialBorderIt);
@@ -734,7 +733,6 @@ pair<const bool, vector<unsigned int>> MetricAttribute::tauFarValueDataIdsAndChe
 	  for (vector<Value*>::iterator tauFarPotentialValueIt = lowerPotentialBorderIt; tauFarPotentialValueIt != potentialEnd; ++tauFarPotentialValueIt)
 	    {
 	      irrelevantValueDataIds.push_back((*tauFarPotentialValueIt)->getDataId());
-	      delete *tauFarPotentialValueIt;
 	    }
 	  const unsigned int nbOfValueBeforeErasure = values.size();
 	  values.erase(lowerPotentialBorderIt, potentialEnd);
@@ -18,9 +18,13 @@
 class MetricAttribute: public Attribute
 {
  public:
-  MetricAttribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels, const double tau);
+  MetricAttribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels, const double tau, Arena& arena);
 
-  MetricAttribute* clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd) const;
+  MetricAttribute* clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena) const;
+
+#ifdef TRAIL
+  void becomeChild();
+#endif
 
   void chooseValue();
   void setChosenValuePresent();	 /* to be called on the attribute that is the child of the one where the value was chosen */
@@ -42,9 +46,9 @@ class MetricAttribute: public Attribute
   static vector<double> tauVector; // 0 if the attribute is not totally ordered
   static vector<vector<double>> timestampsVector;
 
-  MetricAttribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd);
+  MetricAttribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena);
 
-  void setChildValueIntersections(const vector<unsigned int>& noiseInIntersectionWithPresentValues, const vector<unsigned int>& noiseInIntersectionWithPresentAndPotentialValues, vector<unsigned int>& childNoiseInIntersectionWithPresentValues, vector<unsigned int>& childNoiseInIntersectionWithPresentAndPotentialValues) const;
+  void setChildValueIntersections(const unsigned int* noiseInIntersectionWithPresentValues, const unsigned int* noiseInIntersectionWithPresentAndPotentialValues, unsigned int* childNoiseInIntersectionWithPresentValues, unsigned int* childNoiseInIntersectionWithPresentAndPotentialValues) const;
 
   void removeAbsentValue(vector<Value*>::iterator& valueIt);
 };
@@ -12,13 +12,26 @@
 
 double Node::maxMembershipMinusSimilarityShift;
 unsigned int Node::nbOfGoodParents = 0;
+bool Node::isExhaustive = true;
+unsigned int Node::nbOfThreads = 1;
+unsigned int Node::nbOfConstructedNodes = 0;
+unsigned long long Node::candidateMemory = 0;
+unsigned long long Node::maximalCandidateMemory = numeric_limits<unsigned long long>::max();
 
 list<Node*> Node::dendrogram;
 list<Node*> Node::dendrogramFrontier;
-set<Node*, const bool(*)(const Node*, const Node*)> Node::candidates(morePromising);
-unordered_map<vector<vector<unsigned int>>, Node*, vector_hash<vector<unsigned int>>> Node::candidateNSets;
+IndexedHeap<Node, &Node::candidatePosition> Node::candidates(morePromising);
+unordered_map<unsigned long long, Node*> Node::candidateNSets;
+vector<unordered_map<unsigned long long, vector<list<Node*>::iterator>>> Node::frontierBuckets(nbOfBands);
 
-Node::Node(const vector<Attribute*>& attributes): pattern(), membershipSum(0), area(1), g(0), gEstimation(0), nextTuple(), parents(), lastGoodParentIt(), children()
+// Estimated bytes of a candidate besides the Node: its position in the heap of candidates and its entry in candidateNSets
+static const unsigned long long candidateOverhead = sizeof(Node*) + sizeof(pair<const unsigned long long, Node*>) + 2 * sizeof(void*);
+// Estimated bytes of a generating pair: the children of the candidate and the candidate in the parents of both children
+static const unsigned long long pairFootprint = 2 * sizeof(list<Node*>::iterator) + 2 * sizeof(Node*);
+// Estimated bytes of a pair in a batch given to constructCandidatesInParallel: its leaf ids, what is computed for it and, at worst, a new candidate
+static const unsigned long long pairInBatchFootprint = sizeof(pair<unsigned int, unsigned int>) + sizeof(unsigned long long) + sizeof(unsigned int) + sizeof(double) + sizeof(unsigned int) + sizeof(Node*) + sizeof(Node) + candidateOverhead + pairFootprint;
+
+Node::Node(const vector<Attribute*>& attributes): pattern(), rank(nbOfConstructedNodes++), fingerprint(0), membershipSum(0), area(1), g(0), gEstimation(0), candidatePosition(0), nextTuple(), parents(), bandKeys(), children()
 {
   ++nbOfGoodParents;
   pattern.reserve(attributes.size());
@@ -35,7 +48,7 @@ Node::Node(const vector<Attribute*>& attributes): pattern(), membershipSum(0), a
   dendrogramFrontier.push_back(this);
 }
 
-Node::Node(const vector<vector<unsigned int>>& nSet, const Trie* data): pattern(nSet), membershipSum(0), area(1), g(0), gEstimation(0), nextTuple(), parents(), lastGoodParentIt(), children()
+Node::Node(const vector<vector<unsigned int>>& nSet, const Trie* data): pattern(nSet), rank(nbOfConstructedNodes++), fingerprint(0), membershipSum(0), area(1), g(0), gEstimation(0), candidatePosition(0), nextTuple(), parents(), bandKeys(), children()
 {
   ++nbOfGoodParents;
   nextTuple.reserve(nSet.size());
@@ -50,17 +63,9 @@ Node::Node(const vector<vector<unsigned int>>& nSet, const Trie* data): pattern(
   dendrogramFrontier.push_back(this);
 }
 
-Node::Node(const vector<vector<unsigned int>>& nSet, const list<Node*>::iterator child1It, const list<Node*>::iterator child2It): pattern(nSet), membershipSum(0), area(1), g(0), gEstimation(0), nextTuple(), parents(), lastGoodParentIt(), children {child1It, child2It}
+Node::Node(const unsigned long long fingerprintParam, const unsigned int areaParam, const double gEstimationParam, const list<Node*>::iterator child1It, const list<Node*>::iterator child2It): pattern(), rank(0), fingerprint(fingerprintParam), membershipSum(maxMembershipMinusSimilarityShift * areaParam), area(areaParam), g(0), gEstimation(gEstimationParam), candidatePosition(0), nextTuple(), parents(), bandKeys(), children {child1It, child2It}
 {
-  nextTuple.reserve(nSet.size());
-  for (const vector<unsigned int>& patternDimension : pattern)
-    {
-      area *= patternDimension.size();
-      nextTuple.push_back(patternDimension.begin());
-    }
-  membershipSum = maxMembershipMinusSimilarityShift * area;
   computeG();
-  gEstimation = gEstimationFromLastTwoChildren();
 }
 
 const vector<unsigned int>& Node::dimension(const unsigned int dimensionId) const
@@ -73,24 +78,34 @@ const unsigned int Node::getArea() const
   return area;
 }
 
-void Node::constructCandidate(const list<Node*>::iterator child1It, const list<Node*>::iterator child2It)
+vector<vector<unsigned int>> Node::unionNSet(const Node& child1, const Node& child2)
 {
   vector<vector<unsigned int>> unionNSet;
-  unionNSet.reserve((*child1It)->pattern.size());
-  vector<vector<unsigned int>>::const_iterator otherPatternIt = (*child2It)->pattern.begin();
-  for (const vector<unsigned int>& patternDimension : (*child1It)->pattern)
+  unionNSet.reserve(child1.pattern.size());
+  vector<vector<unsigned int>>::const_iterator otherPatternIt = child2.pattern.begin();
+  for (const vector<unsigned int>& patternDimension : child1.pattern)
     {
       unionNSet.push_back(idVectorUnion(*otherPatternIt, patternDimension));
       ++otherPatternIt;
     }
-  const unordered_map<vector<vector<unsigned int>>, Node*, vector_hash<vector<unsigned int>>>::iterator candidateNSetIt = candidateNSets.find(unionNSet);
+  return unionNSet;
+}
+
+void Node::constructCandidate(const list<Node*>::iterator child1It, const list<Node*>::iterator child2It)
+{
+  const vector<vector<unsigned int>> unionNSet = Node::unionNSet(**child1It, **child2It);
+  const unsigned long long fingerprint = nSetFingerprint(unionNSet);
+  const unordered_map<unsigned long long, Node*>::iterator candidateNSetIt = candidateNSets.find(fingerprint);
   if (candidateNSetIt == candidateNSets.end())
     {
-      Node* candidate = new Node(unionNSet, child1It, child2It);
-      candidateNSets[unionNSet] = candidate;
-      candidates.insert(candidates.begin(), candidate);
-      (*child1It)->parents.insert(candidate);
-      (*child2It)->parents.insert(candidate);
+      const unsigned int area = nSetArea(unionNSet);
+      Node* candidate = new Node(fingerprint, area, estimateG(**child1It, **child2It, unionNSet, area), child1It, child2It);
+      candidate->rank = nbOfConstructedNodes++;
+      candidateNSets[fingerprint] = candidate;
+      candidates.push(candidate);
+      candidateMemory += candidate->footprint();
+      (*child1It)->addParent(candidate);
+      (*child2It)->addParent(candidate);
       return;
     }
   Node* candidate = candidateNSetIt->second;
@@ -101,6 +116,7 @@ void Node::constructCandidate(const list<Node*>::iterator child1It, const list<N
     }
   candidate->children.push_back(child1It);
   candidate->children.push_back(child2It);
+  candidateMemory += pairFootprint;
   // const double newGEstimation = candidate->gEstimationFromLastTwoChildren();
   // if (newGEstimation > candidate->gEstimation)
   //   {
@@ -109,19 +125,255 @@ void Node::constructCandidate(const list<Node*>::iterator child1It, const list<N
   // 	{
   // 	  (*candidateChildIt)->parents.erase(candidate);
   // 	  candidate->gEstimation = newGEstimation;
-  // 	  (*candidateChildIt)->parents.insert(candidate);
+  // 	  (*candidateChildIt)->addParent(candidate);
   // 	  candidate->gEstimation = oldGEstimation;
   // 	}
   //     candidates.erase(candidate);
   //     candidate->gEstimation = newGEstimation;
   //     candidates.insert(candidate);
   //   }
-  (*child1It)->parents.insert(candidate);
-  (*child2It)->parents.insert(candidate);
+  (*child1It)->addParent(candidate);
+  (*child2It)->addParent(candidate);
+}
+
+// Same candidates, children and parents as if constructCandidate was sequentially called on every pair (the order of leafIdPairs only depends on the ranks of the leaves, hence not on the threads)
+void Node::constructCandidatesInParallel(const vector<list<Node*>::iterator>& leafIts, const vector<pair<unsigned int, unsigned int>>::const_iterator leafIdPairBegin, const vector<pair<unsigned int, unsigned int>>::const_iterator leafIdPairEnd)
+{
+  const unsigned int nbOfPairs = leafIdPairEnd - leafIdPairBegin;
+  if (nbOfPairs == 0)
+    {
+      return;
+    }
+  const unsigned int nbOfTasks = 4 * nbOfThreads;
+  WorkStealingPool pool(nbOfThreads);
+  // Compute the fingerprints of the unions, their areas and the estimations of their g (the unions are not kept)
+  vector<unsigned long long> fingerprints(nbOfPairs);
+  vector<unsigned int> areas(nbOfPairs);
+  vector<double> gEstimations(nbOfPairs);
+  const unsigned int nbOfPairsPerTask = nbOfPairs / nbOfTasks + 1;
+  for (unsigned int begin = 0; begin < nbOfPairs; begin += nbOfPairsPerTask)
+    {
+      const unsigned int end = min(begin + nbOfPairsPerTask, nbOfPairs);
+      pool.submit([&leafIts, leafIdPairBegin, &fingerprints, &areas, &gEstimations, begin, end]()
+		  {
+		    for (unsigned int pairId = begin; pairId != end; ++pairId)
+		      {
+			const Node& child1 = **leafIts[leafIdPairBegin[pairId].first];
+			const Node& child2 = **leafIts[leafIdPairBegin[pairId].second];
+			const vector<vector<unsigned int>> unionNSet = Node::unionNSet(child1, child2);
+			fingerprints[pairId] = nSetFingerprint(unionNSet);
+			areas[pairId] = nSetArea(unionNSet);
+			gEstimations[pairId] = estimateG(child1, child2, unionNSet, areas[pairId]);
+		      }
+		  });
+    }
+  pool.wait();
+  // Every task takes care of the fingerprints that are congruent to its id modulo nbOfTasks: it finds the candidate constructed in a previous batch or the first pair generating each union, for which it constructs the candidate
+  vector<unsigned int> firstPairIds(nbOfPairs); /* nbOfPairs if the candidate was constructed in a previous batch */
+  vector<Node*> pairCandidates(nbOfPairs);
+  for (unsigned int taskId = 0; taskId != nbOfTasks; ++taskId)
+    {
+      pool.submit([&leafIts, leafIdPairBegin, &fingerprints, &areas, &gEstimations, &firstPairIds, &pairCandidates, nbOfPairs, nbOfTasks, taskId]()
+		  {
+		    unordered_map<unsigned long long, unsigned int> firstPairIdsInTask;
+		    for (unsigned int pairId = 0; pairId != nbOfPairs; ++pairId)
+		      {
+			if (fingerprints[pairId] % nbOfTasks == taskId)
+			  {
+			    const unordered_map<unsigned long long, Node*>::const_iterator candidateNSetIt = candidateNSets.find(fingerprints[pairId]);
+			    if (candidateNSetIt != candidateNSets.end())
+			      {
+				firstPairIds[pairId] = nbOfPairs;
+				pairCandidates[pairId] = candidateNSetIt->second;
+				continue;
+			      }
+			    const unsigned int firstPairId = firstPairIdsInTask.insert(pair<unsigned long long, unsigned int>(fingerprints[pairId], pairId)).first->second;
+			    firstPairIds[pairId] = firstPairId;
+			    if (firstPairId == pairId)
+			      {
+				pairCandidates[pairId] = new Node(fingerprints[pairId], areas[pairId], gEstimations[pairId], leafIts[leafIdPairBegin[pairId].first], leafIts[leafIdPairBegin[pairId].second]);
+			      }
+			  }
+		      }
+		  });
+    }
+  pool.wait();
+  // Merge in the order of the pairs
+  vector<unsigned int>::const_iterator firstPairIdIt = firstPairIds.begin();
+  unsigned int pairId = 0;
+  for (vector<pair<unsigned int, unsigned int>>::const_iterator leafIdPairIt = leafIdPairBegin; leafIdPairIt != leafIdPairEnd; ++leafIdPairIt)
+    {
+      const list<Node*>::iterator child1It = leafIts[leafIdPairIt->first];
+      const list<Node*>::iterator child2It = leafIts[leafIdPairIt->second];
+      Node* candidate = pairCandidates[*firstPairIdIt == nbOfPairs ? pairId : *firstPairIdIt];
+      if (*firstPairIdIt++ == pairId++)
+	{
+	  candidate->rank = nbOfConstructedNodes++;
+	  candidateNSets[candidate->fingerprint] = candidate;
+	  candidates.push(candidate);
+	  candidateMemory += candidate->footprint();
+	}
+      else
+	{
+	  candidate->children.push_back(child1It);
+	  candidate->children.push_back(child2It);
+	  candidateMemory += pairFootprint;
+	}
+      (*child1It)->addParent(candidate);
+      (*child2It)->addParent(candidate);
+    }
+  if (candidateMemory > maximalCandidateMemory)
+    {
+      evictLeastPromisingCandidates();
+    }
+}
+
+static unsigned long long mix(unsigned long long value)
+{
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111ebULL;
+  return value ^ (value >> 31);
+}
+
+const unsigned long long Node::nSetFingerprint(const vector<vector<unsigned int>>& nSet)
+{
+  // Two distinct n-sets with the same fingerprint are confused, what is very improbable with 64 bits
+  unsigned long long fingerprint = 0;
+  for (const vector<unsigned int>& nSetDimension : nSet)
+    {
+      for (const unsigned int id : nSetDimension)
+	{
+	  fingerprint = mix(fingerprint + id + 1);
+	}
+      fingerprint = mix(fingerprint ^ 0x9e3779b97f4a7c15ULL);
+    }
+  return fingerprint;
+}
+
+const unsigned int Node::nSetArea(const vector<vector<unsigned int>>& nSet)
+{
+  unsigned int area = 1;
+  for (const vector<unsigned int>& nSetDimension : nSet)
+    {
+      area *= nSetDimension.size();
+    }
+  return area;
+}
+
+void Node::computeBandKeys()
+{
+  // MinHash signature of the elements of pattern, tagged with their dimensions
+  vector<unsigned long long> signature(nbOfBands * nbOfRowsPerBand, numeric_limits<unsigned long long>::max());
+  const unsigned long long n = pattern.size();
+  unsigned long long dimensionId = 0;
+  for (const vector<unsigned int>& patternDimension : pattern)
+    {
+      for (const unsigned int element : patternDimension)
+	{
+	  const unsigned long long item = mix(element * n + dimensionId);
+	  unsigned long long seed = 0;
+	  for (unsigned long long& minHash : signature)
+	    {
+	      const unsigned long long hash = mix(item ^ (seed += 0x9e3779b97f4a7c15ULL));
+	      if (hash < minHash)
+		{
+		  minHash = hash;
+		}
+	    }
+	}
+      ++dimensionId;
+    }
+  bandKeys.clear();
+  bandKeys.reserve(nbOfBands);
+  for (vector<unsigned long long>::const_iterator minHashIt = signature.begin(); minHashIt != signature.end(); )
+    {
+      unsigned long long bandKey = 0;
+      for (unsigned int rowId = 0; rowId != nbOfRowsPerBand; ++rowId)
+	{
+	  bandKey = mix(bandKey ^ *minHashIt++);
+	}
+      bandKeys.push_back(bandKey);
+    }
+}
+
+void Node::indexInDendrogramFrontier(const list<Node*>::iterator nodeIt)
+{
+  if ((*nodeIt)->bandKeys.empty())
+    {
+      (*nodeIt)->computeBandKeys();
+    }
+  vector<unordered_map<unsigned long long, vector<list<Node*>::iterator>>>::iterator bucketsIt = frontierBuckets.begin();
+  for (const unsigned long long bandKey : (*nodeIt)->bandKeys)
+    {
+      (*bucketsIt++)[bandKey].push_back(nodeIt);
+    }
+}
+
+void Node::unindexInDendrogramFrontier(const list<Node*>::iterator nodeIt)
+{
+  vector<unordered_map<unsigned long long, vector<list<Node*>::iterator>>>::iterator bucketsIt = frontierBuckets.begin();
+  for (const unsigned long long bandKey : (*nodeIt)->bandKeys)
+    {
+      const unordered_map<unsigned long long, vector<list<Node*>::iterator>>::iterator bucketIt = bucketsIt->find(bandKey);
+      vector<list<Node*>::iterator>& nodeIts = bucketIt->second;
+      if (nodeIts.size() == 1)
+	{
+	  bucketsIt->erase(bucketIt);
+	}
+      else
+	{
+	  // Keep the order of insertion, the last inserted nodes being the partners of the next inserted node
+	  nodeIts.erase(find(nodeIts.begin(), nodeIts.end(), nodeIt));
+	}
+      ++bucketsIt;
+    }
+}
+
+vector<list<Node*>::iterator> Node::partnersInDendrogramFrontier() const
+{
+  vector<list<Node*>::iterator> partners;
+  const unsigned int nbOfPartnersPerBand = max(1u, nbOfGoodParents / nbOfBands);
+  vector<unordered_map<unsigned long long, vector<list<Node*>::iterator>>>::const_iterator bucketsIt = frontierBuckets.begin();
+  for (const unsigned long long bandKey : bandKeys)
+    {
+      const unordered_map<unsigned long long, vector<list<Node*>::iterator>>::const_iterator bucketIt = bucketsIt->find(bandKey);
+      if (bucketIt != bucketsIt->end())
+	{
+	  const vector<list<Node*>::iterator>& nodeIts = bucketIt->second;
+	  const vector<list<Node*>::iterator>::const_iterator end = nodeIts.size() > nbOfPartnersPerBand ? nodeIts.end() - nbOfPartnersPerBand : nodeIts.begin();
+	  for (vector<list<Node*>::iterator>::const_iterator nodeItIt = nodeIts.end(); nodeItIt != end; )
+	    {
+	      partners.push_back(*--nodeItIt);
+	    }
+	}
+      ++bucketsIt;
+    }
+  return partners;
+}
+
+void Node::addParent(Node* parent)
+{
+  const vector<Node*>::iterator parentIt = lower_bound(parents.begin(), parents.end(), parent);
+  if (parentIt == parents.end() || *parentIt != parent)
+    {
+      parents.insert(parentIt, parent);
+    }
+}
+
+void Node::removeParent(const Node* parent)
+{
+  const vector<Node*>::iterator parentIt = lower_bound(parents.begin(), parents.end(), parent);
+  if (parentIt != parents.end() && *parentIt == parent)
+    {
+      parents.erase(parentIt);
+    }
 }
 
 void Node::unlinkGeneratingPairsInvolving(const Node* child)
 {
+  const unsigned int nbOfChildren = children.size();
   unordered_set<Node*> otherComponentsOfErasedPairs;
   for (vector<list<Node*>::iterator>::iterator otherChildItIt = children.begin(); otherChildItIt != children.end(); )
     {
@@ -167,6 +419,7 @@ void Node::unlinkGeneratingPairsInvolving(const Node* child)
 	    }
 	}
     }
+  candidateMemory -= (nbOfChildren - children.size()) / 2 * pairFootprint;
   // Do not unlink a child if still in a valid generating pair
   for (const list<Node*>::iterator childIt : children)
     {
@@ -175,7 +428,7 @@ void Node::unlinkGeneratingPairsInvolving(const Node* child)
   // Unlink the rest of them
   for (Node* otherChild : otherComponentsOfErasedPairs)
     {
-      otherChild->parents.erase(this);
+      otherChild->removeParent(this);
     }
 }
 
@@ -189,14 +442,12 @@ void Node::computeG()
   g = membershipSum * membershipSum / area;
 }
 
-const double Node::gEstimationFromLastTwoChildren() const
+const double Node::estimateG(const Node& child1, const Node& child2, const vector<vector<unsigned int>>& nSet, const unsigned int area)
 {
-  const Node& child1 = ***(children.end() - 2);
-  const Node& child2 = **children.back();
   unsigned int nbOfTuplesInIntersection = 1;
   vector<vector<unsigned int>>::const_iterator child1DimensionIt = child1.pattern.begin();
   vector<vector<unsigned int>>::const_iterator child2DimensionIt = child2.pattern.begin();
-  for (const vector<unsigned int>& patternDimension : pattern)
+  for (const vector<unsigned int>& patternDimension : nSet)
     {
       nbOfTuplesInIntersection *= child1DimensionIt->size() + child2DimensionIt->size() - patternDimension.size();
     }
@@ -311,32 +562,61 @@ vector<list<Node*>::iterator> Node::getParentChildren()
 
 void Node::insertInDendrogramFrontier()
 {
-  children.clear();
-  // *this goes to dendrogramFrontier
-  dendrogramFrontier.push_back(this);
-  // Construct the new candidates or add children to it if already constructed
-  const list<Node*>::iterator thisIt = --dendrogramFrontier.end();
-  for (list<Node*>::iterator otherChildIt = dendrogramFrontier.begin(); otherChildIt != thisIt; ++otherChildIt)
+  if (isExhaustive)
+    {
+      children.clear();
+      // *this goes to dendrogramFrontier
+      dendrogramFrontier.push_back(this);
+      // Construct the new candidates or add children to it if already constructed
+      const list<Node*>::iterator thisIt = --dendrogramFrontier.end();
+      for (list<Node*>::iterator otherChildIt = dendrogramFrontier.begin(); otherChildIt != thisIt; ++otherChildIt)
+	{
+	  constructCandidate(thisIt, otherChildIt); // Subsets of *this are found during candidate construction and inserted in children
+	}
+    }
+  else
     {
-      constructCandidate(thisIt, otherChildIt); // Subsets of *this are found during candidate construction and inserted in children
+      // The generating children of *this, which are subsets of *this, and the nodes sharing buckets with *this are its partners
+      computeBandKeys();
+      vector<list<Node*>::iterator> partners = partnersInDendrogramFrontier();
+      partners.insert(partners.begin(), children.begin(), children.end());
+      children.clear();
+      // *this goes to dendrogramFrontier
+      dendrogramFrontier.push_back(this);
+      // Construct the new candidates or add children to it if already constructed
+      const list<Node*>::iterator thisIt = --dendrogramFrontier.end();
+      unordered_set<const Node*> constructedPartners;
+      for (const list<Node*>::iterator otherChildIt : partners)
+	{
+	  if (constructedPartners.insert(*otherChildIt).second)
+	    {
+	      constructCandidate(thisIt, otherChildIt); // Subsets of *this are found during candidate construction and inserted in children
+	    }
+	}
+      indexInDendrogramFrontier(thisIt);
     }
 #ifdef DEBUG_HA
   cout << "  " << children.size() << " children" << endl;
 #endif
   // Remove this n-set from candidateNSets
-  candidateNSets.erase(pattern);
+  candidateNSets.erase(fingerprint);
   vector<list<Node*>::iterator> newChildren;
   for (const list<Node*>::iterator childIt : children)
     {
+      if (!isExhaustive)
+	{
+	  unindexInDendrogramFrontier(childIt);
+	}
       // Unlink **childIt from *this and its other parents
-      (*childIt)->parents.erase(this);
+      (*childIt)->removeParent(this);
       for (Node* parent : (*childIt)->parents)
 	{
 	  parent->unlinkGeneratingPairsInvolving(*childIt);
 	  if (parent->children.empty())
 	    {
-	      candidateNSets.erase(parent->pattern);
+	      candidateNSets.erase(parent->fingerprint);
 	      candidates.erase(parent);
+	      candidateMemory -= parent->footprint();
 	      delete parent;
 	    }
 	}
@@ -357,9 +637,70 @@ void Node::insertInDendrogramFrontier()
   children = newChildren;
 }
 
+void Node::materialize()
+{
+  // Every generating pair has the union of its nodes as union
+  candidateMemory -= footprint();
+  pattern = unionNSet(**children.front(), **children[1]);
+  nextTuple.reserve(pattern.size());
+  for (const vector<unsigned int>& patternDimension : pattern)
+    {
+      nextTuple.push_back(patternDimension.begin());
+    }
+  candidateMemory += footprint();
+}
+
+const unsigned long long Node::footprint() const
+{
+  unsigned long long footprint = sizeof(Node) + candidateOverhead + children.size() / 2 * pairFootprint;
+  for (const vector<unsigned int>& patternDimension : pattern)
+    {
+      footprint += sizeof(vector<unsigned int>) + sizeof(vector<unsigned int>::const_iterator) + patternDimension.size() * sizeof(unsigned int);
+    }
+  return footprint;
+}
+
+void Node::evict()
+{
+  for (const list<Node*>::iterator childIt : children)
+    {
+      (*childIt)->removeParent(this);
+    }
+  candidateNSets.erase(fingerprint);
+  candidates.erase(this);
+  candidateMemory -= footprint();
+  delete this;
+}
+
+void Node::evictLeastPromisingCandidates()
+{
+  // Keep the most promising candidates within three quarters of maximalCandidateMemory, so that the sort is amortized over many insertions, and at least the most promising one
+  if (candidates.empty())
+    {
+      return;
+    }
+  vector<Node*> candidatesByPromise = candidates.getElements();
+  sort(candidatesByPromise.begin(), candidatesByPromise.end(), morePromising);
+  const unsigned long long targetMemory = maximalCandidateMemory / 4 * 3;
+  const vector<Node*>::const_iterator end = candidatesByPromise.end();
+  vector<Node*>::const_iterator candidateIt = candidatesByPromise.begin();
+  unsigned long long keptMemory = (*candidateIt)->footprint();
+  for (++candidateIt; candidateIt != end && keptMemory + (*candidateIt)->footprint() <= targetMemory; ++candidateIt)
+    {
+      keptMemory += (*candidateIt)->footprint();
+    }
+#ifdef DEBUG_HA
+  cout << "  " << end - candidateIt << " candidates evicted" << endl;
+#endif
+  for (; candidateIt != end; ++candidateIt)
+    {
+      (*candidateIt)->evict();
+    }
+}
+
 const bool Node::morePromising(const Node* node1, const Node* node2)
 {
-  return node1->g > node2->g || (node1->g == node2->g && (node1->gEstimation > node2->gEstimation || (node1->gEstimation == node2->gEstimation && node1 < node2)));
+  return node1->g > node2->g || (node1->g == node2->g && (node1->gEstimation > node2->gEstimation || (node1->gEstimation == node2->gEstimation && node1->rank < node2->rank)));
 }
 
 const bool Node::moreRelevant(const Node* node1, const Node* node2)
@@ -367,11 +708,26 @@ const bool Node::moreRelevant(const Node* node1, const Node* node2)
   return node2->g < node1->g;
 }
 
+const bool Node::smallerPattern(const Node* node1, const Node* node2)
+{
+  return node1->pattern < node2->pattern;
+}
+
 void Node::setSimilarityShift(const double similarityShift)
 {
   maxMembershipMinusSimilarityShift = similarityShift + Attribute::noisePerUnit;
 }
 
+void Node::setNbOfThreads(const unsigned int nbOfThreadsParam)
+{
+  nbOfThreads = nbOfThreadsParam;
+}
+
+void Node::setMaximalCandidateMemory(const unsigned long long maximalCandidateMemoryParam)
+{
+  maximalCandidateMemory = maximalCandidateMemoryParam;
+}
+
 pair<list<Node*>::const_iterator, list<Node*>::const_iterator> Node::agglomerateAndSelect(const Trie* data, const double maximalNbOfCandidateAgglomerates)
 {
   if (dendrogramFrontier.empty())
@@ -381,17 +737,83 @@ pair<list<Node*>::const_iterator, list<Node*>::const_iterator> Node::agglomerate
 #ifdef DEBUG_HA
   cout << endl << "Dendrogram:" << endl << endl << "* " << nbOfGoodParents << " leaves generating at most " << static_cast<unsigned int>(maximalNbOfCandidateAgglomerates / nbOfGoodParents) << " candidates each:" << endl;
 #endif
-  nbOfGoodParents = maximalNbOfCandidateAgglomerates / nbOfGoodParents;
-  // Candidate construction
+  nbOfGoodParents = max(1., maximalNbOfCandidateAgglomerates / nbOfGoodParents);
+  // The leaves were constructed in an order that depends on the threads: sort them by pattern and rank them in that order, so that the pairs and the ties between candidates do not depend on it
+  dendrogramFrontier.sort(smallerPattern);
+  nbOfConstructedNodes = 0;
+  for (Node* leaf : dendrogramFrontier)
+    {
+      leaf->rank = nbOfConstructedNodes++;
+    }
+  vector<list<Node*>::iterator> leafIts;
+  leafIts.reserve(nbOfConstructedNodes);
   const list<Node*>::iterator end = dendrogramFrontier.end();
-  for (list<Node*>::iterator child1It = dendrogramFrontier.begin(); child1It != end; ++child1It)
+  for (list<Node*>::iterator leafIt = dendrogramFrontier.begin(); leafIt != end; ++leafIt)
     {
+      leafIts.push_back(leafIt);
+    }
 #ifdef DEBUG_HA
-      (*child1It)->print(cout);
+  for (const list<Node*>::iterator leafIt : leafIts)
+    {
+      (*leafIt)->print(cout);
+    }
 #endif
-      for (list<Node*>::iterator child2It = dendrogramFrontier.begin(); child2It != child1It; ++child2It)
+  // Candidate construction: all pairs of leaves if maximalNbOfCandidateAgglomerates allows it; otherwise, pair every leaf with the next leaves in its buckets (at most nbOfGoodParents pairs per leaf), the pairs being constructed in the same order as if they all were
+  // The pairs are constructed in batches that fit in a quarter of maximalCandidateMemory, the least promising candidates being evicted in between, so that the candidates and what is computed for the pairs of a batch stay within maximalCandidateMemory
+  const double nbOfLeaves = leafIts.size();
+  const double nbOfPairsOfLeaves = nbOfLeaves * (nbOfLeaves - 1) / 2;
+  const unsigned long long nbOfPairsPerBatch = max(1ULL, maximalCandidateMemory / 4 / pairInBatchFootprint);
+  isExhaustive = nbOfPairsOfLeaves <= maximalNbOfCandidateAgglomerates;
+  vector<pair<unsigned int, unsigned int>> leafIdPairs;
+  if (isExhaustive)
+    {
+      leafIdPairs.reserve(min(static_cast<double>(nbOfPairsPerBatch), nbOfPairsOfLeaves));
+      for (unsigned int leafId = 1; leafId < nbOfLeaves; ++leafId)
 	{
-	  constructCandidate(child1It, child2It);
+	  for (unsigned int otherLeafId = 0; otherLeafId != leafId; ++otherLeafId)
+	    {
+	      leafIdPairs.push_back(pair<unsigned int, unsigned int>(leafId, otherLeafId));
+	      if (leafIdPairs.size() == nbOfPairsPerBatch)
+		{
+		  constructCandidatesInParallel(leafIts, leafIdPairs.begin(), leafIdPairs.end());
+		  leafIdPairs.clear();
+		}
+	    }
+	}
+      constructCandidatesInParallel(leafIts, leafIdPairs.begin(), leafIdPairs.end());
+    }
+  else
+    {
+      // Hash the leaves in buckets, the leaves in a same bucket probably sharing many elements
+      for (const list<Node*>::iterator leafIt : leafIts)
+	{
+	  indexInDendrogramFrontier(leafIt);
+	}
+      const unsigned int nbOfPartnersPerBand = max(1u, nbOfGoodParents / (2 * nbOfBands));
+      for (const unordered_map<unsigned long long, vector<list<Node*>::iterator>>& bucketsInBand : frontierBuckets)
+	{
+	  for (const pair<const unsigned long long, vector<list<Node*>::iterator>>& bucket : bucketsInBand)
+	    {
+	      const vector<list<Node*>::iterator>::const_iterator bucketEnd = bucket.second.end();
+	      for (vector<list<Node*>::iterator>::const_iterator leafItIt = bucket.second.begin(); leafItIt != bucketEnd; ++leafItIt)
+		{
+		  const vector<list<Node*>::iterator>::const_iterator partnerEnd = bucketEnd - leafItIt > nbOfPartnersPerBand ? leafItIt + nbOfPartnersPerBand + 1 : bucketEnd;
+		  for (vector<list<Node*>::iterator>::const_iterator partnerItIt = leafItIt + 1; partnerItIt != partnerEnd; ++partnerItIt)
+		    {
+		      // The leaves were inserted in the buckets in the order of dendrogramFrontier, i.e., of their ranks
+		      leafIdPairs.push_back(pair<unsigned int, unsigned int>((**partnerItIt)->rank, (**leafItIt)->rank));
+		    }
+		}
+	    }
+	}
+      sort(leafIdPairs.begin(), leafIdPairs.end());
+      leafIdPairs.erase(unique(leafIdPairs.begin(), leafIdPairs.end()), leafIdPairs.end());
+      const vector<pair<unsigned int, unsigned int>>::const_iterator leafIdPairEnd = leafIdPairs.end();
+      for (vector<pair<unsigned int, unsigned int>>::const_iterator leafIdPairIt = leafIdPairs.begin(); leafIdPairIt != leafIdPairEnd; )
+	{
+	  const vector<pair<unsigned int, unsigned int>>::const_iterator batchEnd = static_cast<unsigned long long>(leafIdPairEnd - leafIdPairIt) > nbOfPairsPerBatch ? leafIdPairIt + nbOfPairsPerBatch : leafIdPairEnd;
+	  constructCandidatesInParallel(leafIts, leafIdPairIt, batchEnd);
+	  leafIdPairIt = batchEnd;
 	}
     }
   // Hierarchical agglomeration
@@ -400,36 +822,52 @@ pair<list<Node*>::const_iterator, list<Node*>::const_iterator> Node::agglomerate
 #endif
   while (!candidates.empty())
     {
-      // Searching for the candidates with the smallest intrinsic distance and the largest area (in case of equality according to both criteria, the one with the smallest memory address is retained)
+      // Searching for the candidates with the smallest intrinsic distance and the largest area (in case of equality according to both criteria, the one constructed first is retained)
       double highestG = -numeric_limits<double>::infinity();
-      while ((*candidates.begin())->nextTuple.front() != (*candidates.begin())->pattern.front().end())
-    	{
-    	  Node* candidate = *candidates.begin();
-    	  // candidate->g is partial
-    	  candidates.erase(candidates.begin());
-    	  const bool isBetter = data->isBetterNSet(sqrt(highestG * candidate->area), candidate->pattern, candidate->nextTuple, candidate->membershipSum);
-    	  candidate->computeG();
-    	  if (isBetter)
-    	    {
-    	      highestG = candidate->g;
-    	    }
-    	  candidates.insert(candidate);
-    	}
-      Node* candidateToInsert = *candidates.begin();
+      Node* candidate = candidates.top();
+      while (candidate->pattern.empty() || candidate->nextTuple.front() != candidate->pattern.front().end())
+	{
+	  if (candidate->pattern.empty())
+	    {
+	      candidate->materialize();
+	    }
+	  // candidate->g is partial
+	  const bool isBetter = data->isBetterNSet(sqrt(highestG * candidate->area), candidate->pattern, candidate->nextTuple, candidate->membershipSum);
+	  candidate->computeG();
+	  if (isBetter)
+	    {
+	      highestG = candidate->g;
+	    }
+	  candidates.update(candidate);
+	  candidate = candidates.top();
+	}
 #ifdef DEBUG_HA
-      (*candidateToInsert).print(cout);
+      (*candidate).print(cout);
 #endif
-      candidates.erase(candidates.begin());
-      candidateToInsert->insertInDendrogramFrontier();
+      candidates.pop();
+      candidateMemory -= candidate->footprint();
+      candidate->insertInDendrogramFrontier();
+      if (candidateMemory > maximalCandidateMemory)
+	{
+	  evictLeastPromisingCandidates();
+	}
     }
-  Node* root = dendrogramFrontier.front();
-  if (root->getParentChildren().empty())
+  // The candidates do not include all pairs of nodes: there may be several roots
+  for (Node* root : dendrogramFrontier)
     {
-      dendrogram.push_back(root);
+      if (root->getParentChildren().empty())
+	{
+	  dendrogram.push_back(root);
+	}
+      else
+	{
+	  delete root;
+	}
     }
-  else
+  dendrogramFrontier.clear();
+  for (unordered_map<unsigned long long, vector<list<Node*>::iterator>>& bucketsInBand : frontierBuckets)
     {
-      delete root;
+      bucketsInBand.clear();
     }
   // Order the nodes, more relevant first
   dendrogram.sort(moreRelevant);
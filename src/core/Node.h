@@ -11,10 +11,11 @@
 #ifndef NODE_H_
 #define NODE_H_
 
-#include <set>
 #include <iostream>
 
 #include "../utilities/list_iterator_hash.h"
+#include "../utilities/WorkStealingPool.h"
+#include "../utilities/IndexedHeap.h"
 #include "Trie.h"
 
 class Node
@@ -27,50 +28,71 @@ class Node
   const unsigned int getArea() const;
 
   static void setSimilarityShift(const double similarityShift);
+  static void setNbOfThreads(const unsigned int nbOfThreads);
+  static void setMaximalCandidateMemory(const unsigned long long maximalCandidateMemory);
   static pair<list<Node*>::const_iterator, list<Node*>::const_iterator> agglomerateAndSelect(const Trie* data, const double maximalNbOfCandidateAgglomerates);
 
  protected:
-  struct MorePromisingParent
-  {
-    const bool operator()(const Node* node1, const Node* node2)
-    {
-      return node1->gEstimation > node2->gEstimation || (node1->gEstimation == node2->gEstimation && node1 < node2);
-    }
-  };
-
-  vector<vector<unsigned int>> pattern;
+  vector<vector<unsigned int>> pattern; /* empty for the candidates that were not refined yet */
+  unsigned int rank;		/* order of construction, to break ties independently of the memory addresses */
+  unsigned long long fingerprint; /* only relevant for candidates and nodes in dendrogramFrontier that were candidates, the fingerprint of their n-set */
   double membershipSum;		/* only relevant for candidates and nodes in dendrogramFrontier to estimate g */
   unsigned int area;		/* only relevant for candidates and nodes in dendrogramFrontier to estimate g */
   double g;
   double gEstimation;					  /* only relevant for candidates */
+  unsigned int candidatePosition;			  /* only relevant for candidates, their position in the heap of candidates */
   vector<vector<unsigned int>::const_iterator> nextTuple; /* only relevant for candidates */
-  set<Node*, MorePromisingParent> parents; /* only relevant for nodes in dendrogramFrontier, empty otherwise */
-  set<Node*>::iterator lastGoodParentIt; /* only relevant for nodes in dendrogramFrontier, all parents up to **lastGoodParentIt have this as a first generating child; all parents after lastGoodParentIt do not have this as a first generating child */
+  vector<Node*> parents; /* only relevant for nodes in dendrogramFrontier, empty otherwise, sorted by address */
+  vector<unsigned long long> bandKeys; /* only relevant for nodes in dendrogramFrontier, the keys of the bands of the MinHash signature of pattern */
   vector<list<Node*>::iterator> children; /* if *this is candidate, the pairs of nodes in dendrogramFrontier that generate it and it is one of the good candidate for every first child of a pair; if inserted in dendrogram frontier, its subsets in the dendrogram */
 
+  static const unsigned int nbOfBands = 8;
+  static const unsigned int nbOfRowsPerBand = 2;
+
   static double maxMembershipMinusSimilarityShift;
   static unsigned int nbOfGoodParents;
+  static bool isExhaustive;	/* whether every pair of nodes in dendrogramFrontier generates a candidate, i.e., whether maximalNbOfCandidateAgglomerates allows it for the leaves */
+  static unsigned int nbOfThreads;
+  static unsigned int nbOfConstructedNodes;
+  static unsigned long long candidateMemory; /* estimation of the bytes used by the candidates */
+  static unsigned long long maximalCandidateMemory;
 
   static list<Node*> dendrogram;
   static list<Node*> dendrogramFrontier;
-  static set<Node*, const bool(*)(const Node*, const Node*)> candidates;
-  static unordered_map<vector<vector<unsigned int>>, Node*, vector_hash<vector<unsigned int>>> candidateNSets;
+  static IndexedHeap<Node, &Node::candidatePosition> candidates;
+  static unordered_map<unsigned long long, Node*> candidateNSets; /* the candidates and the node being inserted in dendrogramFrontier per fingerprint of their n-sets */
+  static vector<unordered_map<unsigned long long, vector<list<Node*>::iterator>>> frontierBuckets; /* for every band of the MinHash signatures, the nodes in dendrogramFrontier per band key */
 
-  Node(const vector<vector<unsigned int>>& nSet, const list<Node*>::iterator child1, const list<Node*>::iterator child2);
+  Node(const unsigned long long fingerprint, const unsigned int area, const double gEstimation, const list<Node*>::iterator child1, const list<Node*>::iterator child2);
 
   void computeG();
-  const double gEstimationFromLastTwoChildren() const;
   const unsigned int countFutureChildren(const double ancestorG) const;
 
+  void addParent(Node* parent);
+  void removeParent(const Node* parent);
   void unlinkGeneratingPairsInvolving(const Node* child);
   void deleteOffspringWithSmallerG(const double ancestorG, vector<list<Node*>::iterator>& ancestorChildren);
   vector<list<Node*>::iterator> getParentChildren();
   void insertInDendrogramFrontier();
+  vector<list<Node*>::iterator> partnersInDendrogramFrontier() const; /* the nodes last inserted in the buckets of *this, at most max(1, nbOfGoodParents / nbOfBands) per bucket */
+  void computeBandKeys();
+  void materialize();
+  const unsigned long long footprint() const;
+  void evict();
 
   /* static const bool morePromisingParent(const Node* node1, const Node* node2); */
   static const bool morePromising(const Node* node1, const Node* node2);
   static const bool moreRelevant(const Node* node1, const Node* node2);
+  static const bool smallerPattern(const Node* node1, const Node* node2);
   static void constructCandidate(const list<Node*>::iterator otherChildIt, const list<Node*>::iterator thisIt);
+  static void constructCandidatesInParallel(const vector<list<Node*>::iterator>& leafIts, const vector<pair<unsigned int, unsigned int>>::const_iterator leafIdPairBegin, const vector<pair<unsigned int, unsigned int>>::const_iterator leafIdPairEnd); /* evicts the least promising candidates if candidateMemory exceeds maximalCandidateMemory afterwards */
+  static vector<vector<unsigned int>> unionNSet(const Node& child1, const Node& child2);
+  static const unsigned long long nSetFingerprint(const vector<vector<unsigned int>>& nSet);
+  static const unsigned int nSetArea(const vector<vector<unsigned int>>& nSet);
+  static const double estimateG(const Node& child1, const Node& child2, const vector<vector<unsigned int>>& nSet, const unsigned int area);
+  static void evictLeastPromisingCandidates();
+  static void indexInDendrogramFrontier(const list<Node*>::iterator nodeIt);
+  static void unindexInDendrogramFrontier(const list<Node*>::iterator nodeIt);
   static vector<unsigned int> idVectorUnion(const vector<unsigned int>& v1, const vector<unsigned int>& v2);
 
 #ifdef DEBUG_HA
@@ -10,42 +10,39 @@
 
 #include "NoisyTupleFileReader.h"
 
-NoisyTupleFileReader::NoisyTupleFileReader(const char* noisyNSetFileNameParam, const vector<unsigned int>& symDimensionIdsParam, const vector<unsigned int>& numDimensionIdsParam, const char* inputDimensionSeparator, const char* inputElementSeparator) : noisyNSetFileName(noisyNSetFileNameParam), noisyNSetFile(noisyNSetFileName), symDimensionIds(symDimensionIdsParam), numDimensionIds(numDimensionIdsParam), minMembership(1. / numeric_limits<unsigned int>::max()), inputDimensionSeparator(inputDimensionSeparator), inputElementSeparator(inputElementSeparator), lineNb(0), ids2Labels(), labels2Ids(), symIds2Labels(), symLabels2Ids(), nSet(), membership(0), tupleIts()
+#include <cstring>
+
+unsigned int NoisyTupleFileReader::nbOfThreads = 1;
+
+NoisyTupleFileReader::Chunk::Chunk(const char* beginParam, const char* endParam): begin(beginParam), end(endParam), nbOfLines(0), labels2Ids(), ids2Labels(), symLabels2Ids(), symIds2Labels(), memberships(), nSets(), localIds2Ids(), errorLineNb(0), errorMessage()
+{
+}
+
+NoisyTupleFileReader::NoisyTupleFileReader(const char* noisyNSetFileNameParam, const vector<unsigned int>& symDimensionIdsParam, const vector<unsigned int>& numDimensionIdsParam, const char* inputDimensionSeparator, const char* inputElementSeparator) : noisyNSetFileName(noisyNSetFileNameParam), noisyNSetFile(noisyNSetFileNameParam), nextLineBegin(noisyNSetFile.begin()), symDimensionIds(symDimensionIdsParam), numDimensionIds(numDimensionIdsParam), minMembership(1. / numeric_limits<unsigned int>::max()), inputDimensionSeparator(inputDimensionSeparator), inputElementSeparator(inputElementSeparator), lineNb(0), line(), dimensions(), ids2Labels(), labels2Ids(), symIds2Labels(), symLabels2Ids(), nSet(), membership(0), tupleIts(), chunks(), chunkIt(), chunkMembershipIt(), chunkNSetIt(), isBinary(BinaryNoisyTupleFile::isBinary(noisyNSetFile.begin(), noisyNSetFile.end())), binaryTupleIt(nullptr), binaryTupleEnd(nullptr), binaryMemberships(nullptr), binaryMembershipIndexIt(nullptr), binaryMembershipIndexSize(0), binaryIds2Labels(), binaryIds2SymIds(), binaryOldIds2NewIds()
 {
-  if (!noisyNSetFile)
+  if (isBinary)
     {
-      throw NoFileException(noisyNSetFileNameParam);
+      initBinary();
+      return;
     }
   init();
 }
 
 void NoisyTupleFileReader::init()
 {
-  if (noisyNSetFile.eof())
+  if (!nextLine())
     {
-      noisyNSetFile.close();
       membership = 0;
       return;
     }
-  ++lineNb;
-  string noisyNSetString;
-  getline(noisyNSetFile, noisyNSetString);
-  tokenizer<char_separator<char>> dimensions(noisyNSetString, inputDimensionSeparator);
-  tokenizer<char_separator<char>>::const_iterator dimensionIt = dimensions.begin();
-  if (dimensionIt == dimensions.end())
-    {
-      init();
-      return;
-    }
-  unsigned int n = 0;
+  const unsigned int n = dimensions.size() - 1;
   vector<unsigned int>::const_iterator symDimensionIdIt = symDimensionIds.begin();
-  while (++dimensionIt != dimensions.end())
+  for (unsigned int dimensionId = 0; dimensionId != n; ++dimensionId)
     {
-      if (symDimensionIdIt != symDimensionIds.end() && *symDimensionIdIt == n)
+      if (symDimensionIdIt != symDimensionIds.end() && *symDimensionIdIt == dimensionId)
 	{
 	  ++symDimensionIdIt;
 	}
-      ++n;
     }
   if (symDimensionIdIt != symDimensionIds.end())
     {
@@ -55,15 +52,98 @@ void NoisyTupleFileReader::init()
   labels2Ids.resize(n);
   nSet.resize(n);
   tupleIts.resize(n);
-#ifdef VERBOSE_PARSER
-  cout << noisyNSetFileName << ':' << lineNb << ": " << noisyNSetString << endl;
-#endif
-  if (parseLine(dimensions.begin(), dimensions.end()))
+  if (parseLine())
     {
       nextNSet();
     }
 }
 
+void NoisyTupleFileReader::initBinary()
+{
+  // The labels of the non-symmetric dimensions are views of the mapped file and their ids are those in the file: no dictionary is built
+  const char* const fileEnd = noisyNSetFile.end();
+  const string truncationMessage = noisyNSetFileName + " is a truncated binary data file!";
+  if (fileEnd - noisyNSetFile.begin() < static_cast<long long>(sizeof(BinaryNoisyTupleFile::Header)))
+    {
+      throw DataFormatException(truncationMessage.c_str());
+    }
+  const BinaryNoisyTupleFile::Header& header = *reinterpret_cast<const BinaryNoisyTupleFile::Header*>(noisyNSetFile.begin());
+  const unsigned int n = header.n;
+  if (!symDimensionIds.empty() && symDimensionIds.back() >= n)
+    {
+      throw UsageException(("clique option should provide attribute ids between 0 and " + lexical_cast<string>(n - 1)).c_str());
+    }
+  ids2Labels.resize(n);
+  labels2Ids.resize(n);
+  binaryIds2Labels.resize(n);
+  binaryIds2SymIds.resize(n);
+  binaryOldIds2NewIds.resize(n);
+  const char* sectionIt = noisyNSetFile.begin() + sizeof(BinaryNoisyTupleFile::Header);
+  vector<unsigned int>::const_iterator symDimensionIdIt = symDimensionIds.begin();
+  for (unsigned int dimensionId = 0; dimensionId != n; ++dimensionId)
+    {
+      if (fileEnd - sectionIt < static_cast<long long>(sizeof(unsigned long long)))
+	{
+	  throw DataFormatException(truncationMessage.c_str());
+	}
+      const unsigned long long nbOfLabels = *reinterpret_cast<const unsigned long long*>(sectionIt);
+      const unsigned long long* offsets = reinterpret_cast<const unsigned long long*>(sectionIt) + 1;
+      const char* labels = reinterpret_cast<const char*>(offsets + nbOfLabels + 1);
+      if (nbOfLabels > static_cast<unsigned long long>(fileEnd - sectionIt) / sizeof(unsigned long long) || labels > fileEnd || offsets[nbOfLabels] > static_cast<unsigned long long>(fileEnd - labels))
+	{
+	  throw DataFormatException(truncationMessage.c_str());
+	}
+      sectionIt = BinaryNoisyTupleFile::align(labels + offsets[nbOfLabels]);
+      if (symDimensionIdIt != symDimensionIds.end() && *symDimensionIdIt == dimensionId)
+	{
+	  // The symmetric dimensions share their labels, hence one dictionary
+	  ++symDimensionIdIt;
+	  vector<unsigned int>& ids2SymIds = binaryIds2SymIds[dimensionId];
+	  ids2SymIds.reserve(nbOfLabels);
+	  for (const unsigned long long* offsetIt = offsets; offsetIt != offsets + nbOfLabels; ++offsetIt)
+	    {
+	      const string_ref label(labels + *offsetIt, offsetIt[1] - *offsetIt);
+	      const pair<Labels2Ids::const_iterator, bool> label2Id = symLabels2Ids.insert(pair<string_ref, unsigned int>(label, symIds2Labels.size()));
+	      if (label2Id.second)
+		{
+		  symIds2Labels.push_back(string(label.begin(), label.end()));
+		}
+	      ids2SymIds.push_back(label2Id.first->second);
+	    }
+	  continue;
+	}
+      const bool isNumeric = binary_search(numDimensionIds.begin(), numDimensionIds.end(), dimensionId);
+      binaryIds2Labels[dimensionId].reserve(nbOfLabels);
+      ids2Labels[dimensionId].reserve(nbOfLabels);
+      for (const unsigned long long* offsetIt = offsets; offsetIt != offsets + nbOfLabels; ++offsetIt)
+	{
+	  const string_ref label(labels + *offsetIt, offsetIt[1] - *offsetIt);
+	  double numericalLabel;
+	  if (isNumeric && !conversion::try_lexical_convert(label.data(), label.size(), numericalLabel))
+	    {
+	      throw DataFormatException((noisyNSetFileName + ": " + string(label.begin(), label.end()) + ", in dimension " + lexical_cast<string>(dimensionId) + " (almost-contiguous according to tau option) should be a double!").c_str());
+	    }
+	  binaryIds2Labels[dimensionId].push_back(label);
+	  ids2Labels[dimensionId].push_back(string(label.begin(), label.end()));
+	}
+    }
+  if (static_cast<unsigned long long>(fileEnd - sectionIt) < header.nbOfMemberships * sizeof(double) + header.nbOfTuples * (n * sizeof(unsigned int) + header.membershipIndexSize))
+    {
+      throw DataFormatException(truncationMessage.c_str());
+    }
+  binaryMemberships = reinterpret_cast<const double*>(sectionIt);
+  binaryTupleIt = reinterpret_cast<const unsigned int*>(binaryMemberships + header.nbOfMemberships);
+  binaryTupleEnd = binaryTupleIt + header.nbOfTuples * n;
+  binaryMembershipIndexIt = BinaryNoisyTupleFile::align(reinterpret_cast<const char*>(binaryTupleEnd));
+  binaryMembershipIndexSize = header.membershipIndexSize;
+  if (binaryMembershipIndexIt + header.nbOfTuples * binaryMembershipIndexSize > fileEnd)
+    {
+      throw DataFormatException(truncationMessage.c_str());
+    }
+  nSet.resize(n);
+  membership = 1;
+}
+
 const vector<string>& NoisyTupleFileReader::getIds2Labels(const unsigned int dimensionId) const
 {
   return ids2Labels[dimensionId];
@@ -91,6 +171,10 @@ vector<unsigned int> NoisyTupleFileReader::getCardinalities() const
 
 pair<vector<unsigned int>, double> NoisyTupleFileReader::next()
 {
+  if (isBinary)
+    {
+      return nextInBinary();
+    }
   if (membership == 0)
     {
       return pair<vector<unsigned int>, double>(vector<unsigned int>(), 0);
@@ -120,6 +204,55 @@ pair<vector<unsigned int>, double> NoisyTupleFileReader::next()
   return noisyTuple;
 }
 
+pair<vector<unsigned int>, double> NoisyTupleFileReader::nextInBinary()
+{
+  const unsigned int n = nSet.size();
+  while (binaryTupleIt != binaryTupleEnd)
+    {
+      const unsigned int* tupleEnd = binaryTupleIt + n;
+      unsigned int membershipIndex;
+      switch (binaryMembershipIndexSize)
+	{
+	case 1:
+	  membershipIndex = *reinterpret_cast<const unsigned char*>(binaryMembershipIndexIt);
+	  break;
+	case 2:
+	  membershipIndex = *reinterpret_cast<const unsigned short*>(binaryMembershipIndexIt);
+	  break;
+	default:
+	  membershipIndex = *reinterpret_cast<const unsigned int*>(binaryMembershipIndexIt);
+	}
+      binaryMembershipIndexIt += binaryMembershipIndexSize;
+      membership = binaryMemberships[membershipIndex];
+      if (membership >= minMembership)
+	{
+	  pair<vector<unsigned int>, double> noisyTuple(vector<unsigned int>(binaryTupleIt, tupleEnd), membership);
+	  binaryTupleIt = tupleEnd;
+	  if (symDimensionIds.empty())
+	    {
+	      return noisyTuple;
+	    }
+	  for (const unsigned int symDimensionId : symDimensionIds)
+	    {
+	      noisyTuple.first[symDimensionId] = binaryIds2SymIds[symDimensionId][noisyTuple.first[symDimensionId]];
+	    }
+	  // Checking whether the tuple is a self loop
+	  vector<unsigned int>::const_iterator symDimensionIdIt = symDimensionIds.begin();
+	  const unsigned int symmetricElement = noisyTuple.first[*symDimensionIdIt];
+	  while (++symDimensionIdIt != symDimensionIds.end() && noisyTuple.first[*symDimensionIdIt] == symmetricElement)
+	    {
+	    }
+	  if (symDimensionIdIt != symDimensionIds.end())
+	    {
+	      return noisyTuple;
+	    }
+	}
+      binaryTupleIt = tupleEnd;
+    }
+  membership = 0;
+  return pair<vector<unsigned int>, double>(vector<unsigned int>(), 0);
+}
+
 void NoisyTupleFileReader::setMinMembership(const double minMembershipParam)
 {
   minMembership = minMembershipParam;
@@ -127,11 +260,16 @@ void NoisyTupleFileReader::setMinMembership(const double minMembershipParam)
 
 void NoisyTupleFileReader::startOverFromNextLine()
 {
+  if (isBinary)
+    {
+      // The tuples below the minimal membership are skipped anyway and the ids do not depend on them
+      return;
+    }
   for (vector<string>& ids2LabelsInDimension : ids2Labels)
     {
       ids2LabelsInDimension.clear();
     }
-  for (unordered_map<string, unsigned int>& labels2IdsInDimension : labels2Ids)
+  for (Labels2Ids& labels2IdsInDimension : labels2Ids)
     {
       labels2IdsInDimension.clear();
     }
@@ -140,53 +278,96 @@ void NoisyTupleFileReader::startOverFromNextLine()
   nextNSet();
 }
 
-void NoisyTupleFileReader::printTuplesInFirstDimensionHyperplane(ostream& out, const unsigned int firstDimensionHyperplaneId, const unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator begin, const unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator end, const string& outputDimensionSeparator) const
+void NoisyTupleFileReader::parseRemainingLinesInParallel()
 {
-  string prefix;
-  if (ids2Labels.front().empty())
+#ifndef VERBOSE_PARSER
+  const char* const fileEnd = noisyNSetFile.end();
+  if (isBinary || nbOfThreads == 1 || membership == 0 || nextLineBegin == fileEnd)
     {
-      // Symmetric dimension
-      prefix = symIds2Labels[firstDimensionHyperplaneId] + outputDimensionSeparator;
+      return;
     }
-  else
+  // Cut the remaining lines into chunks of similar sizes, several per thread for the load to be balanced
+  const unsigned long long chunkSize = (fileEnd - nextLineBegin) / (4 * nbOfThreads) + 1;
+  for (const char* chunkBegin = nextLineBegin; chunkBegin != fileEnd; )
     {
-      // Non-symmetric dimension
-      prefix = ids2Labels.front()[firstDimensionHyperplaneId] + outputDimensionSeparator;
+      const char* chunkEnd = fileEnd;
+      if (static_cast<unsigned long long>(fileEnd - chunkBegin) > chunkSize)
+	{
+	  chunkEnd = static_cast<const char*>(memchr(chunkBegin + chunkSize, '\n', fileEnd - chunkBegin - chunkSize));
+	  chunkEnd = chunkEnd ? chunkEnd + 1 : fileEnd;
+	}
+      chunks.push_back(Chunk(chunkBegin, chunkEnd));
+      chunkBegin = chunkEnd;
     }
-  for (unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator tupleIt = begin; tupleIt != end; ++tupleIt)
+  nextLineBegin = fileEnd;
+  {
+    WorkStealingPool pool(nbOfThreads);
+    for (Chunk& chunk : chunks)
+      {
+	pool.submit([this, &chunk]() { parseChunk(chunk); });
+      }
+    pool.wait();
+  }
+  // The chunks are merged in the order of the file, hence the same ids as with a sequential parsing
+  for (Chunk& chunk : chunks)
     {
-      if (tupleIt != begin)
+      if (chunk.errorLineNb != 0)
 	{
-	  out << endl;
+	  throw DataFormatException(noisyNSetFileName.c_str(), lineNb + chunk.errorLineNb, chunk.errorMessage.c_str());
 	}
-      out << prefix;
-      vector<vector<string>>::const_iterator ids2LabelsIt = ids2Labels.begin();
-      for (const unsigned int element : tupleIt->first)
+      lineNb += chunk.nbOfLines;
+      mergeChunk(chunk);
+    }
+  chunkIt = chunks.begin();
+  chunkMembershipIt = chunkIt->memberships.begin();
+  chunkNSetIt = chunkIt->nSets.begin();
+#endif
+}
+
+void NoisyTupleFileReader::printTuple(ostream& out, const vector<unsigned int>& tuple, const double membership, const string& outputDimensionSeparator) const
+{
+  vector<vector<string>>::const_iterator ids2LabelsIt = ids2Labels.begin();
+  for (const unsigned int element : tuple)
+    {
+      if (ids2LabelsIt->empty())
 	{
-	  if ((++ids2LabelsIt)->empty())
-	    {
-	      // Symmetric dimension
-	      out << symIds2Labels[element] << outputDimensionSeparator;
-	    }
-	  else
-	    {
-	      // Non-symmetric dimension
-	      out << (*ids2LabelsIt)[element] << outputDimensionSeparator;
-	    }
+	  // Symmetric dimension
+	  out << symIds2Labels[element] << outputDimensionSeparator;
 	}
-      out << tupleIt->second;
+      else
+	{
+	  // Non-symmetric dimension
+	  out << (*ids2LabelsIt)[element] << outputDimensionSeparator;
+	}
+      ++ids2LabelsIt;
     }
+  out << membership;
 }
 
 vector<string> NoisyTupleFileReader::setNewIdsAndGetLabels(const unsigned int dimensionId, const vector<unsigned int>& oldIds2NewIds, const unsigned int nbOfValidLabels)
 {
   vector<string> labels(nbOfValidLabels);
-  for (pair<const string, unsigned int>& label2Id : labels2Ids[dimensionId])
+  if (isBinary)
+    {
+      vector<string>::iterator oldLabelIt = ids2Labels[dimensionId].begin();
+      for (const unsigned int newId : oldIds2NewIds)
+	{
+	  if (newId != numeric_limits<unsigned int>::max())
+	    {
+	      labels[newId] = move(*oldLabelIt);
+	    }
+	  ++oldLabelIt;
+	}
+      binaryOldIds2NewIds[dimensionId] = oldIds2NewIds;
+      return labels;
+    }
+  for (pair<const string_ref, unsigned int>& label2Id : labels2Ids[dimensionId])
     {
-      label2Id.second = oldIds2NewIds[label2Id.second];
+      const unsigned int oldId = label2Id.second;
+      label2Id.second = oldIds2NewIds[oldId];
       if (label2Id.second != numeric_limits<unsigned int>::max())
 	{
-	  labels[label2Id.second] = label2Id.first;
+	  labels[label2Id.second] = move(ids2Labels[dimensionId][oldId]);
 	}
     }
   return labels;
@@ -195,131 +376,164 @@ vector<string> NoisyTupleFileReader::setNewIdsAndGetLabels(const unsigned int di
 vector<string> NoisyTupleFileReader::setNewIdsAndGetSymmetricLabels(const vector<unsigned int>& oldIds2NewIds, const unsigned int nbOfValidLabels)
 {
   vector<string> labels(nbOfValidLabels);
-  for (pair<const string, unsigned int>& label2Id : symLabels2Ids)
+  for (pair<const string_ref, unsigned int>& label2Id : symLabels2Ids)
     {
-      label2Id.second = oldIds2NewIds[label2Id.second];
+      const unsigned int oldId = label2Id.second;
+      label2Id.second = oldIds2NewIds[oldId];
       if (label2Id.second != numeric_limits<unsigned int>::max())
 	{
-	  labels[label2Id.second] = label2Id.first;
+	  labels[label2Id.second] = move(symIds2Labels[oldId]);
 	}
     }
   return labels;
 }
 
-unordered_map<string, unsigned int>&& NoisyTupleFileReader::captureLabels2Ids(const unsigned int dimensionId)
+unordered_map<string, unsigned int> NoisyTupleFileReader::captureLabels2Ids(const unsigned int dimensionId)
+{
+  if (isBinary)
+    {
+      unordered_map<string, unsigned int> labels2IdsInDimension;
+      labels2IdsInDimension.reserve(binaryIds2Labels[dimensionId].size());
+      vector<unsigned int>::const_iterator newIdIt = binaryOldIds2NewIds[dimensionId].begin();
+      for (const string_ref& label : binaryIds2Labels[dimensionId])
+	{
+	  labels2IdsInDimension.insert(pair<string, unsigned int>(string(label.begin(), label.end()), *newIdIt++));
+	}
+      return labels2IdsInDimension;
+    }
+  unordered_map<string, unsigned int> labels2IdsInDimension = toStrings(labels2Ids[dimensionId]);
+  labels2Ids[dimensionId].clear();
+  return labels2IdsInDimension;
+}
+
+unordered_map<string, unsigned int> NoisyTupleFileReader::captureSymmetricLabels2Ids()
 {
-  return move(labels2Ids[dimensionId]);
+  unordered_map<string, unsigned int> symmetricLabels2Ids = toStrings(symLabels2Ids);
+  symLabels2Ids.clear();
+  return symmetricLabels2Ids;
 }
 
-unordered_map<string, unsigned int>&& NoisyTupleFileReader::captureSymmetricLabels2Ids()
+unordered_map<string, unsigned int> NoisyTupleFileReader::toStrings(const Labels2Ids& labels2Ids)
 {
-  return move(symLabels2Ids);
+  unordered_map<string, unsigned int> stringLabels2Ids;
+  stringLabels2Ids.reserve(labels2Ids.size());
+  for (const pair<const string_ref, unsigned int>& label2Id : labels2Ids)
+    {
+      stringLabels2Ids.insert(pair<string, unsigned int>(string(label2Id.first.begin(), label2Id.first.end()), label2Id.second));
+    }
+  return stringLabels2Ids;
 }
 
 void NoisyTupleFileReader::nextNSet()
 {
+  if (!chunks.empty())
+    {
+      if (!nextNSetInChunks())
+	{
+	  membership = 0;
+	}
+      return;
+    }
   bool isLineToBeDisconsidered = true;
   while (isLineToBeDisconsidered)
     {
-      if (noisyNSetFile.eof())
+      if (!nextLine())
 	{
-	  noisyNSetFile.close();
 	  membership = 0;
 	  return;
 	}
+      isLineToBeDisconsidered = parseLine();
+    }
+}
+
+const bool NoisyTupleFileReader::nextLine()
+{
+  const char* const fileEnd = noisyNSetFile.end();
+  do
+    {
+      if (nextLineBegin == fileEnd)
+	{
+	  return false;
+	}
       ++lineNb;
-      string noisyNSetString;
-      getline(noisyNSetFile, noisyNSetString);
-      tokenizer<char_separator<char>> dimensions(noisyNSetString, inputDimensionSeparator);
-      if (dimensions.begin() != dimensions.end())
+      const char* lineEnd = static_cast<const char*>(memchr(nextLineBegin, '\n', fileEnd - nextLineBegin));
+      if (!lineEnd)
 	{
-#ifdef VERBOSE_PARSER
-	  cout << noisyNSetFileName << ':' << lineNb << ": " << noisyNSetString << endl;
-#endif
-	  isLineToBeDisconsidered = parseLine(dimensions.begin(), dimensions.end());
+	  lineEnd = fileEnd;
 	}
+      line = string_ref(nextLineBegin, lineEnd - nextLineBegin);
+      nextLineBegin = lineEnd == fileEnd ? fileEnd : lineEnd + 1;
+      splitLine(line, inputDimensionSeparator, dimensions);
     }
+  while (dimensions.empty());
+#ifdef VERBOSE_PARSER
+  cout << noisyNSetFileName << ':' << lineNb << ": " << line << endl;
+#endif
+  return true;
 }
 
-const bool NoisyTupleFileReader::parseLine(const tokenizer<char_separator<char>>::const_iterator dimensionBegin, const tokenizer<char_separator<char>>::const_iterator dimensionEnd)
+const bool NoisyTupleFileReader::parseLine()
 {
-  tokenizer<char_separator<char>>::const_iterator dimensionIt = dimensionBegin;
-  tokenizer<char_separator<char>>::const_iterator membershipIt = dimensionBegin;
-  while (++dimensionIt != dimensionEnd)
+  const string_ref& membershipString = dimensions.back();
+  if (!conversion::try_lexical_convert(membershipString.data(), membershipString.size(), membership) || membership < 0 || membership > 1)
     {
-      membershipIt = dimensionIt;
+      throw DataFormatException(noisyNSetFileName.c_str(), lineNb, ("the membership, " + string(membershipString.begin(), membershipString.end()) + ", should be a double in [0, 1]!").c_str());
     }
-  try
+  if (dimensions.size() - 1 < nSet.size())
     {
-      membership = lexical_cast<double>(*membershipIt);
-      if (membership < 0 || membership > 1)
-	{
-	  throw bad_lexical_cast();
-	}
+      throw DataFormatException(noisyNSetFileName.c_str(), lineNb, ("less than the expected " + lexical_cast<string>(nSet.size()) + " dimensions!").c_str());
     }
-  catch (bad_lexical_cast &)
+  if (dimensions.size() - 1 > nSet.size())
     {
-      throw DataFormatException(noisyNSetFileName.c_str(), lineNb, ("the membership, " + *membershipIt + ", should be a double in [0, 1]!").c_str());
+      throw DataFormatException(noisyNSetFileName.c_str(), lineNb, ("more than the expected " + lexical_cast<string>(nSet.size()) + " dimensions!").c_str());
     }
   unsigned int dimensionId = 0;
   vector<vector<string>>::iterator ids2LabelsIt = ids2Labels.begin();
   vector<unsigned int>::const_iterator symDimensionIdIt = symDimensionIds.begin();
-  dimensionIt = dimensionBegin;
+  vector<string_ref>::const_iterator dimensionIt = dimensions.begin();
   vector<vector<unsigned int>>::iterator nSetIt = nSet.begin();
-  for (unordered_map<string, unsigned int>& labels2IdsInDimension : labels2Ids)
+  for (Labels2Ids& labels2IdsInDimension : labels2Ids)
     {
       nSetIt->clear();
-      tokenizer<char_separator<char>> elements(*dimensionIt, inputElementSeparator);
-      if (symDimensionIdIt != symDimensionIds.end() && *symDimensionIdIt == dimensionId)
+      const bool isSymmetric = symDimensionIdIt != symDimensionIds.end() && *symDimensionIdIt == dimensionId;
+      if (isSymmetric)
 	{
-	  // Symmetric dimension
 	  ++symDimensionIdIt;
-	  for (const string& element : elements)
+	}
+      for (const char* elementBegin = inputElementSeparator.skipMembers(dimensionIt->begin(), dimensionIt->end()); elementBegin != dimensionIt->end(); )
+	{
+	  const char* elementEnd = inputElementSeparator.findMember(elementBegin, dimensionIt->end());
+	  const string_ref element(elementBegin, elementEnd - elementBegin);
+	  elementBegin = inputElementSeparator.skipMembers(elementEnd, dimensionIt->end());
+	  if (isSymmetric)
 	    {
-	      const pair<unordered_map<string, unsigned int>::const_iterator, bool> label2Id = symLabels2Ids.insert(pair<string, unsigned int>(element, symIds2Labels.size()));
+	      const pair<Labels2Ids::const_iterator, bool> label2Id = symLabels2Ids.insert(pair<string_ref, unsigned int>(element, symIds2Labels.size()));
 	      if (label2Id.second)
 		{
-		  symIds2Labels.push_back(element);
+		  symIds2Labels.push_back(string(element.begin(), element.end()));
 		}
 	      nSetIt->push_back(label2Id.first->second);
 	    }
-	}
-      else
-	{
-	  // Non-symmetric dimension
-	  for (const string& element : elements)
+	  else
 	    {
-	      const pair<unordered_map<string, unsigned int>::const_iterator, bool> label2Id = labels2IdsInDimension.insert(pair<string, unsigned int>(element, ids2LabelsIt->size()));
+	      const pair<Labels2Ids::const_iterator, bool> label2Id = labels2IdsInDimension.insert(pair<string_ref, unsigned int>(element, ids2LabelsIt->size()));
 	      if (label2Id.second)
 		{
-		  if (binary_search(numDimensionIds.begin(), numDimensionIds.end(), dimensionId))
+		  double numericalElement;
+		  if (binary_search(numDimensionIds.begin(), numDimensionIds.end(), dimensionId) && !conversion::try_lexical_convert(element.data(), element.size(), numericalElement))
 		    {
-		      try
-			{
-			  lexical_cast<double>(element);
-			}
-		      catch (bad_lexical_cast &)
-			{
-			  throw DataFormatException(noisyNSetFileName.c_str(), lineNb, (element + ", in dimension " + lexical_cast<string>(dimensionId) + " (almost-contiguous according to tau option) should be a double!").c_str());
-			}
+		      throw DataFormatException(noisyNSetFileName.c_str(), lineNb, (string(element.begin(), element.end()) + ", in dimension " + lexical_cast<string>(dimensionId) + " (almost-contiguous according to tau option) should be a double!").c_str());
 		    }
-		  ids2LabelsIt->push_back(element);
+		  ids2LabelsIt->push_back(string(element.begin(), element.end()));
 		}
 	      nSetIt->push_back(label2Id.first->second);
 	    }
 	}
-      if (++dimensionIt == dimensionEnd)
-	{
-	  throw DataFormatException(noisyNSetFileName.c_str(), lineNb, ("less than the expected " + lexical_cast<string>(nSet.size()) + " dimensions!").c_str());
-	}
+      ++dimensionIt;
       ++ids2LabelsIt;
       ++nSetIt;
       ++dimensionId;
     }
-  if (dimensionIt != membershipIt)
-    {
-      throw DataFormatException(noisyNSetFileName.c_str(), lineNb, ("more than the expected " + lexical_cast<string>(nSet.size()) + " dimensions!").c_str());
-    }
   if (membership < minMembership)
     {
       return true;
@@ -345,3 +559,198 @@ void NoisyTupleFileReader::nextTuple()
       nextNSet();
     }
 }
+
+const bool NoisyTupleFileReader::nextNSetInChunks()
+{
+  do
+    {
+      while (chunkMembershipIt == chunkIt->memberships.end())
+	{
+	  // The exhausted chunk is freed
+	  *chunkIt = Chunk(nullptr, nullptr);
+	  if (++chunkIt == chunks.end())
+	    {
+	      return false;
+	    }
+	  chunkMembershipIt = chunkIt->memberships.begin();
+	  chunkNSetIt = chunkIt->nSets.begin();
+	}
+      membership = *chunkMembershipIt++;
+      if (membership < minMembership)
+	{
+	  for (unsigned int dimensionId = 0; dimensionId != nSet.size(); ++dimensionId)
+	    {
+	      chunkNSetIt += *chunkNSetIt + 1;
+	    }
+	}
+    }
+  while (membership < minMembership);
+  vector<vector<unsigned int>>::const_iterator localIds2IdsIt = chunkIt->localIds2Ids.begin();
+  vector<vector<unsigned int>::const_iterator>::iterator tupleItsIt = tupleIts.begin();
+  for (vector<unsigned int>& dimension : nSet)
+    {
+      dimension.clear();
+      for (const vector<unsigned int>::const_iterator end = chunkNSetIt + *chunkNSetIt + 1; ++chunkNSetIt != end; )
+	{
+	  dimension.push_back((*localIds2IdsIt)[*chunkNSetIt]);
+	}
+      *tupleItsIt++ = dimension.begin();
+      ++localIds2IdsIt;
+    }
+  return true;
+}
+
+void NoisyTupleFileReader::parseChunk(Chunk& chunk) const
+{
+  const unsigned int n = nSet.size();
+  chunk.labels2Ids.resize(n);
+  chunk.ids2Labels.resize(n);
+  vector<string_ref> lineDimensions;
+  for (const char* lineBegin = chunk.begin; lineBegin != chunk.end; )
+    {
+      ++chunk.nbOfLines;
+      const char* lineEnd = static_cast<const char*>(memchr(lineBegin, '\n', chunk.end - lineBegin));
+      if (!lineEnd)
+	{
+	  lineEnd = chunk.end;
+	}
+      const string_ref chunkLine(lineBegin, lineEnd - lineBegin);
+      lineBegin = lineEnd == chunk.end ? chunk.end : lineEnd + 1;
+      splitLine(chunkLine, inputDimensionSeparator, lineDimensions);
+      if (lineDimensions.empty())
+	{
+	  continue;
+	}
+      const string_ref& membershipString = lineDimensions.back();
+      double lineMembership;
+      if (!conversion::try_lexical_convert(membershipString.data(), membershipString.size(), lineMembership) || lineMembership < 0 || lineMembership > 1)
+	{
+	  chunk.errorLineNb = chunk.nbOfLines;
+	  chunk.errorMessage = "the membership, " + string(membershipString.begin(), membershipString.end()) + ", should be a double in [0, 1]!";
+	  return;
+	}
+      if (lineDimensions.size() - 1 != n)
+	{
+	  chunk.errorLineNb = chunk.nbOfLines;
+	  chunk.errorMessage = (lineDimensions.size() - 1 < n ? "less than the expected " : "more than the expected ") + lexical_cast<string>(n) + " dimensions!";
+	  return;
+	}
+      chunk.memberships.push_back(lineMembership);
+      unsigned int dimensionId = 0;
+      vector<vector<string_ref>>::iterator ids2LabelsIt = chunk.ids2Labels.begin();
+      vector<unsigned int>::const_iterator symDimensionIdIt = symDimensionIds.begin();
+      vector<string_ref>::const_iterator dimensionIt = lineDimensions.begin();
+      for (Labels2Ids& labels2IdsInDimension : chunk.labels2Ids)
+	{
+	  const unsigned int sizeIndex = chunk.nSets.size();
+	  chunk.nSets.push_back(0);
+	  const bool isSymmetric = symDimensionIdIt != symDimensionIds.end() && *symDimensionIdIt == dimensionId;
+	  if (isSymmetric)
+	    {
+	      ++symDimensionIdIt;
+	    }
+	  for (const char* elementBegin = inputElementSeparator.skipMembers(dimensionIt->begin(), dimensionIt->end()); elementBegin != dimensionIt->end(); )
+	    {
+	      const char* elementEnd = inputElementSeparator.findMember(elementBegin, dimensionIt->end());
+	      const string_ref element(elementBegin, elementEnd - elementBegin);
+	      elementBegin = inputElementSeparator.skipMembers(elementEnd, dimensionIt->end());
+	      if (isSymmetric)
+		{
+		  const pair<Labels2Ids::const_iterator, bool> label2Id = chunk.symLabels2Ids.insert(pair<string_ref, unsigned int>(element, chunk.symIds2Labels.size()));
+		  if (label2Id.second)
+		    {
+		      chunk.symIds2Labels.push_back(element);
+		    }
+		  chunk.nSets.push_back(label2Id.first->second);
+		}
+	      else
+		{
+		  const pair<Labels2Ids::const_iterator, bool> label2Id = labels2IdsInDimension.insert(pair<string_ref, unsigned int>(element, ids2LabelsIt->size()));
+		  if (label2Id.second)
+		    {
+		      double numericalElement;
+		      if (binary_search(numDimensionIds.begin(), numDimensionIds.end(), dimensionId) && !conversion::try_lexical_convert(element.data(), element.size(), numericalElement))
+			{
+			  chunk.errorLineNb = chunk.nbOfLines;
+			  chunk.errorMessage = string(element.begin(), element.end()) + ", in dimension " + lexical_cast<string>(dimensionId) + " (almost-contiguous according to tau option) should be a double!";
+			  return;
+			}
+		      ids2LabelsIt->push_back(element);
+		    }
+		  chunk.nSets.push_back(label2Id.first->second);
+		}
+	    }
+	  chunk.nSets[sizeIndex] = chunk.nSets.size() - sizeIndex - 1;
+	  ++dimensionIt;
+	  ++ids2LabelsIt;
+	  ++dimensionId;
+	}
+    }
+}
+
+void NoisyTupleFileReader::mergeChunk(Chunk& chunk)
+{
+  vector<unsigned int> symLocalIds2Ids;
+  symLocalIds2Ids.reserve(chunk.symIds2Labels.size());
+  for (const string_ref& label : chunk.symIds2Labels)
+    {
+      const pair<Labels2Ids::const_iterator, bool> label2Id = symLabels2Ids.insert(pair<string_ref, unsigned int>(label, symIds2Labels.size()));
+      if (label2Id.second)
+	{
+	  symIds2Labels.push_back(string(label.begin(), label.end()));
+	}
+      symLocalIds2Ids.push_back(label2Id.first->second);
+    }
+  chunk.localIds2Ids.resize(labels2Ids.size());
+  unsigned int dimensionId = 0;
+  vector<unsigned int>::const_iterator symDimensionIdIt = symDimensionIds.begin();
+  vector<vector<string>>::iterator ids2LabelsIt = ids2Labels.begin();
+  vector<Labels2Ids>::iterator labels2IdsIt = labels2Ids.begin();
+  vector<vector<string_ref>>::const_iterator localIds2LabelsIt = chunk.ids2Labels.begin();
+  for (vector<unsigned int>& localIds2IdsInDimension : chunk.localIds2Ids)
+    {
+      if (symDimensionIdIt != symDimensionIds.end() && *symDimensionIdIt == dimensionId)
+	{
+	  ++symDimensionIdIt;
+	  localIds2IdsInDimension = symLocalIds2Ids;
+	}
+      else
+	{
+	  localIds2IdsInDimension.reserve(localIds2LabelsIt->size());
+	  for (const string_ref& label : *localIds2LabelsIt)
+	    {
+	      const pair<Labels2Ids::const_iterator, bool> label2Id = labels2IdsIt->insert(pair<string_ref, unsigned int>(label, ids2LabelsIt->size()));
+	      if (label2Id.second)
+		{
+		  ids2LabelsIt->push_back(string(label.begin(), label.end()));
+		}
+	      localIds2IdsInDimension.push_back(label2Id.first->second);
+	    }
+	}
+      ++ids2LabelsIt;
+      ++labels2IdsIt;
+      ++localIds2LabelsIt;
+      ++dimensionId;
+    }
+  // Only the local ids in the n-sets remain useful
+  vector<Labels2Ids>().swap(chunk.labels2Ids);
+  vector<vector<string_ref>>().swap(chunk.ids2Labels);
+  Labels2Ids().swap(chunk.symLabels2Ids);
+  vector<string_ref>().swap(chunk.symIds2Labels);
+}
+
+void NoisyTupleFileReader::setNbOfThreads(const unsigned int nbOfThreadsParam)
+{
+  nbOfThreads = nbOfThreadsParam;
+}
+
+void NoisyTupleFileReader::splitLine(const string_ref& line, const ByteClassifier& separator, vector<string_ref>& tokens)
+{
+  tokens.clear();
+  for (const char* tokenBegin = separator.skipMembers(line.begin(), line.end()); tokenBegin != line.end(); )
+    {
+      const char* tokenEnd = separator.findMember(tokenBegin, line.end());
+      tokens.push_back(string_ref(tokenBegin, tokenEnd - tokenBegin));
+      tokenBegin = separator.skipMembers(tokenEnd, line.end());
+    }
+}
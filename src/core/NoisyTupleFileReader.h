@@ -13,14 +13,17 @@
 
 #include <map>
 #include <unordered_map>
-#include <fstream>
-#include <boost/tokenizer.hpp>
+#include <boost/lexical_cast.hpp>
 
 #include "../../Parameters.h"
-#include "../utilities/vector_hash.h"
+#include "../utilities/string_ref_hash.h"
+#include "../utilities/MappedFile.h"
+#include "../utilities/ByteClassifier.h"
 #include "../utilities/UsageException.h"
 #include "../utilities/DataFormatException.h"
 #include "../utilities/NoFileException.h"
+#include "../utilities/WorkStealingPool.h"
+#include "BinaryNoisyTupleFile.h"
 
 #ifdef VERBOSE_PARSER
 #include <iostream>
@@ -32,6 +35,11 @@ class NoisyTupleFileReader
 {
  public:
   NoisyTupleFileReader(const char* noisyNSetFileName, const vector<unsigned int>& symDimensionIdsParam, const vector<unsigned int>& numDimensionIdsParam, const char* inputDimensionSeparator, const char* inputElementSeparator);
+  NoisyTupleFileReader(const NoisyTupleFileReader&) = delete;
+  NoisyTupleFileReader(NoisyTupleFileReader&&) = delete;
+
+  NoisyTupleFileReader& operator=(const NoisyTupleFileReader&) = delete;
+  NoisyTupleFileReader& operator=(NoisyTupleFileReader&&) = delete;
 
   const vector<string>& getIds2Labels(const unsigned int dimensionId) const;
   vector<unsigned int> getCardinalities() const;
@@ -39,36 +47,93 @@ class NoisyTupleFileReader
   pair<vector<unsigned int>, double> next();
   void setMinMembership(const double minMembership);
   void startOverFromNextLine();
+  void parseRemainingLinesInParallel(); /* WARNING: startOverFromNextLine cannot be called afterwards */
 
-  void printTuplesInFirstDimensionHyperplane(ostream& out, const unsigned int firstDimensionHyperplaneId, const unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator begin, const unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator end, const string& outputDimensionSeparator) const;
-  /* WARNING: next and printTuplesInFirstDimensionHyperplane cannot be called after the following methods */
+  void printTuple(ostream& out, const vector<unsigned int>& tuple, const double membership, const string& outputDimensionSeparator) const;
+  /* WARNING: next and printTuple cannot be called after the following methods */
   vector<string> setNewIdsAndGetLabels(const unsigned int dimensionId, const vector<unsigned int>& oldIds2NewIds, const unsigned int nbOfValidLabels);
   vector<string> setNewIdsAndGetSymmetricLabels(const vector<unsigned int>& oldIds2NewIds, const unsigned int nbOfValidLabels);
-  unordered_map<string, unsigned int>&& captureLabels2Ids(const unsigned int dimensionId);
-  unordered_map<string, unsigned int>&& captureSymmetricLabels2Ids();
+  unordered_map<string, unsigned int> captureLabels2Ids(const unsigned int dimensionId);
+  unordered_map<string, unsigned int> captureSymmetricLabels2Ids();
+
+  static void setNbOfThreads(const unsigned int nbOfThreads);
 
  protected:
+  /* The labels are looked up through views of the mapped file, which therefore is only unmapped at destruction */
+  typedef unordered_map<string_ref, unsigned int, string_ref_hash> Labels2Ids;
+
+  /* A range of lines parsed by one thread with its own dictionaries, whose ids are only made global when the chunk is merged */
+  struct Chunk
+  {
+    const char* begin;
+    const char* end;
+    unsigned int nbOfLines;
+    vector<Labels2Ids> labels2Ids;
+    vector<vector<string_ref>> ids2Labels;
+    Labels2Ids symLabels2Ids;
+    vector<string_ref> symIds2Labels;
+    vector<double> memberships;
+    vector<unsigned int> nSets; /* for every line, for every dimension, the number of elements followed by their local ids */
+    vector<vector<unsigned int>> localIds2Ids;
+    unsigned int errorLineNb; /* relative to the beginning of the chunk, 0 if no error */
+    string errorMessage;
+
+    Chunk(const char* begin, const char* end);
+    Chunk(const Chunk&) = delete;
+    Chunk(Chunk&&) = default;
+
+    Chunk& operator=(const Chunk&) = delete;
+    Chunk& operator=(Chunk&&) = default;
+  };
+
+  static unsigned int nbOfThreads;
+
   string noisyNSetFileName;
-  ifstream noisyNSetFile;
+  MappedFile noisyNSetFile;
+  const char* nextLineBegin;
   vector<unsigned int> symDimensionIds;
   vector<unsigned int> numDimensionIds;
   double minMembership;
-  char_separator<char> inputDimensionSeparator;
-  char_separator<char> inputElementSeparator;
+  ByteClassifier inputDimensionSeparator;
+  ByteClassifier inputElementSeparator;
   unsigned int lineNb;
+  string_ref line;
+  vector<string_ref> dimensions;
   vector<vector<string>> ids2Labels;
-  vector<unordered_map<string, unsigned int>> labels2Ids;
+  vector<Labels2Ids> labels2Ids;
   vector<string> symIds2Labels;
-  unordered_map<string, unsigned int> symLabels2Ids;
+  Labels2Ids symLabels2Ids;
   vector<vector<unsigned int>> nSet;
   double membership;
   vector<vector<unsigned int>::const_iterator> tupleIts;
+  vector<Chunk> chunks;
+  vector<Chunk>::iterator chunkIt;
+  vector<double>::const_iterator chunkMembershipIt;
+  vector<unsigned int>::const_iterator chunkNSetIt;
+  bool isBinary;
+  const unsigned int* binaryTupleIt;
+  const unsigned int* binaryTupleEnd;
+  const double* binaryMemberships;
+  const char* binaryMembershipIndexIt;
+  unsigned int binaryMembershipIndexSize;
+  vector<vector<string_ref>> binaryIds2Labels; /* empty for the symmetric dimensions */
+  vector<vector<unsigned int>> binaryIds2SymIds; /* empty for the non-symmetric dimensions */
+  vector<vector<unsigned int>> binaryOldIds2NewIds;
 
   /* The two following method set membership to 1 if and only if the end of file is met */
   void init();
+  void initBinary();
+  pair<vector<unsigned int>, double> nextInBinary();
   void nextNSet();
-  const bool parseLine(const tokenizer<char_separator<char>>::const_iterator dimensionBegin, const tokenizer<char_separator<char>>::const_iterator dimensionEnd); /* returns whether the line is to be disconsidered (recursive calls to nextNSet can lead to a stack overflow) */
+  const bool nextLine(); /* splits the next line with at least one dimension into dimensions; returns false if the end of file is met */
+  const bool parseLine(); /* returns whether the line is to be disconsidered (recursive calls to nextNSet can lead to a stack overflow) */
   void nextTuple();
+  const bool nextNSetInChunks(); /* returns false if the last chunk is exhausted */
+  void parseChunk(Chunk& chunk) const;
+  void mergeChunk(Chunk& chunk);
+
+  static void splitLine(const string_ref& line, const ByteClassifier& separator, vector<string_ref>& tokens);
+  static unordered_map<string, unsigned int> toStrings(const Labels2Ids& labels2Ids);
 };
 
 #endif /*NOISY_TUPLE_FILE_READER_H_*/
@@ -26,14 +26,20 @@ vector<unsigned int> getFirst2Index(const vector<pair<unsigned int, double>>& pa
   return oldIds2NewIds;
 }
 
+unsigned int NoisyTuples::nbOfThreads = 1;
+unsigned int NoisyTuples::n = 0;
+vector<unsigned int> NoisyTuples::tuples;
+vector<double> NoisyTuples::memberships;
 vector<unsigned int> NoisyTuples::minimalNbOfTuples;
 vector<double> NoisyTuples::epsilonVector;
 vector<unsigned int> NoisyTuples::symDimensionIds;
 vector<vector<NoisyTuples*>> NoisyTuples::hyperplanes;
 vector<Dimension*> NoisyTuples::dimensions;
 vector<unordered_set<unsigned int>> NoisyTuples::hyperplanesToClear;
+vector<vector<unsigned int>> NoisyTuples::clearingIterations;
+unsigned int NoisyTuples::clearingIteration;
 
-NoisyTuples::NoisyTuples() : tuples(), lowestMembershipInMinimalNSet(2)
+NoisyTuples::NoisyTuples() : tupleIds(), lowestMembershipInMinimalNSet(2)
 {
 }
 
@@ -42,109 +48,164 @@ const bool NoisyTuples::empty() const
   return lowestMembershipInMinimalNSet == 3;
 }
 
-unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator NoisyTuples::begin() const
+vector<unsigned int>::const_iterator NoisyTuples::begin() const
 {
-  return tuples.begin();
+  return tupleIds.begin();
 }
 
-unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator NoisyTuples::end() const
+vector<unsigned int>::const_iterator NoisyTuples::end() const
 {
-  return tuples.end();
+  return tupleIds.end();
 }
 
-void NoisyTuples::insert(const vector<unsigned int>& tuple, const double membership)
+void NoisyTuples::insert(const unsigned int tupleId)
 {
-  tuples[tuple] = membership;
+  tupleIds.push_back(tupleId);
 }
 
-const bool NoisyTuples::erase(const vector<unsigned int>& tuple)
+const unsigned int NoisyTuples::newTuple(const vector<unsigned int>& tuple, const double membership)
 {
-  const unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::iterator tupleToEraseIt = tuples.find(tuple);
-  if (tupleToEraseIt != tuples.end())
+  n = tuple.size();
+  tuples.insert(tuples.end(), tuple.begin(), tuple.end());
+  memberships.push_back(membership);
+  return memberships.size() - 1;
+}
+
+void NoisyTuples::getTuple(const unsigned int tupleId, vector<unsigned int>& tuple)
+{
+  const vector<unsigned int>::const_iterator tupleBegin = tuples.begin() + static_cast<unsigned long long>(tupleId) * n;
+  tuple.assign(tupleBegin, tupleBegin + n);
+}
+
+const double NoisyTuples::getMembership(const unsigned int tupleId)
+{
+  return memberships[tupleId];
+}
+
+void NoisyTuples::eraseDuplicates(vector<vector<NoisyTuples*>>& hyperplanesParam)
+{
+  if (memberships.empty())
+    {
+      return;
+    }
+  // In every hyperplane of the first dimension, sort the ids of the tuples so that the occurrences of a same tuple are contiguous and in the order of the data; only the last one remains
+  WorkStealingPool pool(nbOfThreads);
+  vector<NoisyTuples*>& hyperplanesInFirstDimension = hyperplanesParam.front();
+  vector<char> areDuplicatesInTask(4 * nbOfThreads);
+  runInParallel(pool, hyperplanesInFirstDimension.size(), [&hyperplanesInFirstDimension, &areDuplicatesInTask](const unsigned int begin, const unsigned int end, const unsigned int taskId)
+		{
+		  for (unsigned int hyperplaneId = begin; hyperplaneId != end; ++hyperplaneId)
+		    {
+		      vector<unsigned int>& tupleIds = hyperplanesInFirstDimension[hyperplaneId]->tupleIds;
+		      sort(tupleIds.begin(), tupleIds.end(), [](const unsigned int tupleId1, const unsigned int tupleId2)
+			   {
+			     const vector<unsigned int>::const_iterator tuple1Begin = tuples.begin() + static_cast<unsigned long long>(tupleId1) * n;
+			     const vector<unsigned int>::const_iterator tuple2Begin = tuples.begin() + static_cast<unsigned long long>(tupleId2) * n;
+			     const pair<vector<unsigned int>::const_iterator, vector<unsigned int>::const_iterator> mismatch = std::mismatch(tuple1Begin + 1, tuple1Begin + n, tuple2Begin + 1);
+			     if (mismatch.first == tuple1Begin + n)
+			       {
+				 return tupleId1 < tupleId2;
+			       }
+			     return *mismatch.first < *mismatch.second;
+			   });
+		      bool areDuplicates = false;
+		      for (vector<unsigned int>::const_iterator tupleIdIt = tupleIds.begin(); tupleIdIt + 1 < tupleIds.end(); ++tupleIdIt)
+			{
+			  const vector<unsigned int>::const_iterator tupleBegin = tuples.begin() + static_cast<unsigned long long>(*tupleIdIt) * n;
+			  if (equal(tupleBegin + 1, tupleBegin + n, tuples.begin() + static_cast<unsigned long long>(*(tupleIdIt + 1)) * n + 1))
+			    {
+			      memberships[*tupleIdIt] = 0;
+			      areDuplicates = true;
+			    }
+			}
+		      if (areDuplicates)
+			{
+			  tupleIds.erase(remove_if(tupleIds.begin(), tupleIds.end(), [](const unsigned int tupleId) { return memberships[tupleId] == 0; }), tupleIds.end());
+			  areDuplicatesInTask[taskId] = true;
+			}
+		    }
+		});
+  if (find(areDuplicatesInTask.begin(), areDuplicatesInTask.end(), true) == areDuplicatesInTask.end())
     {
-      // Because lowestMembershipInMinimalNSet initially is 2 and is set to 3 when an hyperplane is already/currently cleared, the following test can only pass for an already processed hyperplane that is yet to be found too noisy
-      if (tupleToEraseIt->second >= lowestMembershipInMinimalNSet)
+      return;
+    }
+  // Erase the overwritten tuples from the hyperplanes of the other dimensions
+  for (vector<vector<NoisyTuples*>>::iterator hyperplanesInDimensionIt = hyperplanesParam.begin() + 1; hyperplanesInDimensionIt != hyperplanesParam.end(); ++hyperplanesInDimensionIt)
+    {
+      vector<NoisyTuples*>& hyperplanesInDimension = *hyperplanesInDimensionIt;
+      runInParallel(pool, hyperplanesInDimension.size(), [&hyperplanesInDimension](const unsigned int begin, const unsigned int end, const unsigned int taskId)
+		    {
+		      for (unsigned int hyperplaneId = begin; hyperplaneId != end; ++hyperplaneId)
+			{
+			  vector<unsigned int>& tupleIds = hyperplanesInDimension[hyperplaneId]->tupleIds;
+			  tupleIds.erase(remove_if(tupleIds.begin(), tupleIds.end(), [](const unsigned int tupleId) { return memberships[tupleId] == 0; }), tupleIds.end());
+			}
+		    });
+    }
+}
+
+void NoisyTuples::deleteTuples()
+{
+  vector<unsigned int>().swap(tuples);
+  vector<double>().swap(memberships);
+  vector<vector<unsigned int>>().swap(clearingIterations);
+  hyperplanes.clear();
+}
+
+const bool NoisyTuples::inHyperplaneClearedBefore(const unsigned int tupleId, const unsigned int dimensionId, const unsigned int iteration)
+{
+  const unsigned int* tuple = tuples.data() + static_cast<unsigned long long>(tupleId) * n;
+  for (unsigned int orthogonalDimensionId = 0; orthogonalDimensionId != n; ++orthogonalDimensionId)
+    {
+      if (orthogonalDimensionId != dimensionId && clearingIterations[orthogonalDimensionId][tuple[orthogonalDimensionId]] < iteration)
 	{
-	  tuples.erase(tupleToEraseIt);
 	  return true;
 	}
-      tuples.erase(tupleToEraseIt);
     }
   return false;
 }
 
-void NoisyTuples::clear(const unsigned int dimensionId, const unsigned int hyperplaneId)
+void NoisyTuples::clear(const unsigned int dimensionId, const unsigned int hyperplaneId, vector<pair<unsigned int, unsigned int>>& hyperplanesToCheck)
 {
-  dimensions[dimensionId]->decrementCardinality();
-  for (unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator tupleIt = tuples.begin(); tupleIt != tuples.end(); tupleIt = tuples.erase(tupleIt))
+  const unsigned int iteration = clearingIterations[dimensionId][hyperplaneId];
+  for (const unsigned int tupleId : tupleIds)
     {
-      // Erasing the same tuple from the orthogonal hyperplanes
-      vector<vector<NoisyTuples*>>::iterator hyperplanesInDimensionIt = hyperplanes.begin();
-      vector<unsigned int>::const_iterator elementIt = tupleIt->first.begin();
-      vector<unsigned int> orthogonalTuple;
-      orthogonalTuple.reserve(tupleIt->first.size());
-      // Constructing the first orthogonal tuple
-      if (dimensionId < 2)
+      // Unless it was already erased at a previous iteration, erase the tuple from the orthogonal hyperplanes, i.e., check again those for which it was among the highest memberships
+      if (!inHyperplaneClearedBefore(tupleId, dimensionId, iteration))
 	{
-	  orthogonalTuple.push_back(hyperplaneId);
-	  orthogonalTuple.insert(orthogonalTuple.end(), elementIt + 1, tupleIt->first.end());
-	}
-      else
-	{
-	  const vector<unsigned int>::const_iterator suffixBegin = elementIt + dimensionId;
-	  orthogonalTuple.insert(orthogonalTuple.end(), elementIt + 1, suffixBegin);
-	  orthogonalTuple.push_back(hyperplaneId);
-	  orthogonalTuple.insert(orthogonalTuple.end(), suffixBegin, tupleIt->first.end());
-	}
-      // Erasing the tuple from the orthogonal hyperplanes whose dimension ids are lesser than that of this hyperplane
-      vector<unsigned int>::iterator orthogonalTupleIt = orthogonalTuple.begin();
-      unsigned int orthogonalDimensionId = 0;
-      for (; orthogonalDimensionId != dimensionId; ++orthogonalDimensionId)
-	{
-	  NoisyTuples& orthogonalHyperplane = *(*hyperplanesInDimensionIt)[*elementIt];
-	  if (orthogonalHyperplane.erase(orthogonalTuple))
-	    {
-	      hyperplanesToClear[orthogonalDimensionId].insert(*elementIt);
-	    }
-	  *orthogonalTupleIt++ = *elementIt++;
-	  ++hyperplanesInDimensionIt;
-	}
-      if (++orthogonalDimensionId != hyperplanes.size())
-	{
-	  // Erasing the tuple from the orthogonal hyperplanes whose dimension ids are greater than that of this hyperplane
-	  for (*orthogonalTupleIt = hyperplaneId; ; *++orthogonalTupleIt = *elementIt++)
+	  const unsigned int* tuple = tuples.data() + static_cast<unsigned long long>(tupleId) * n;
+	  const double membership = memberships[tupleId];
+	  for (unsigned int orthogonalDimensionId = 0; orthogonalDimensionId != n; ++orthogonalDimensionId)
 	    {
-	      NoisyTuples& orthogonalHyperplane = *(*++hyperplanesInDimensionIt)[*elementIt];
-	      if (orthogonalHyperplane.erase(orthogonalTuple))
-		{
-		  hyperplanesToClear[orthogonalDimensionId].insert(*elementIt);
-		}
-	      if (++orthogonalDimensionId == hyperplanes.size())
+	      // Because lowestMembershipInMinimalNSet initially is 2 and is set to 3 when an hyperplane is already/currently cleared, the following test can only pass for an already processed hyperplane that is yet to be found too noisy
+	      if (orthogonalDimensionId != dimensionId && membership >= hyperplanes[orthogonalDimensionId][tuple[orthogonalDimensionId]]->lowestMembershipInMinimalNSet)
 		{
-		  break;
+		  hyperplanesToCheck.push_back(pair<unsigned int, unsigned int>(orthogonalDimensionId, tuple[orthogonalDimensionId]));
 		}
 	    }
 	}
     }
+  vector<unsigned int>().swap(tupleIds);
 }
 
-void NoisyTuples::clearIfTooNoisy(const unsigned int dimensionId, const unsigned int hyperplaneId)
+const bool NoisyTuples::tooNoisy(const unsigned int dimensionId)
 {
+  eraseTuplesInClearedHyperplanes(dimensionId);
   // Given the minimal size constraints, computing the minimal possible noise in a pattern involving this hyperplane
   double minNoise = minimalNbOfTuples[dimensionId];
-  if (!tuples.empty())
+  if (!tupleIds.empty())
     {
       multiset<double> highestMembershipValues;
-      unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator tupleIt = tuples.begin();
-      for (unsigned int minNbOfTuples = minimalNbOfTuples[dimensionId]; tupleIt != tuples.end() && minNbOfTuples != 0; --minNbOfTuples)
+      vector<unsigned int>::const_iterator tupleIdIt = tupleIds.begin();
+      for (unsigned int minNbOfTuples = minimalNbOfTuples[dimensionId]; tupleIdIt != tupleIds.end() && minNbOfTuples != 0; --minNbOfTuples)
 	{
-	  highestMembershipValues.insert(tupleIt->second);
-	  ++tupleIt;
+	  highestMembershipValues.insert(memberships[*tupleIdIt]);
+	  ++tupleIdIt;
 	}
       lowestMembershipInMinimalNSet = *(highestMembershipValues.begin());
-      for (; tupleIt != tuples.end(); ++tupleIt)
+      for (; tupleIdIt != tupleIds.end(); ++tupleIdIt)
 	{
-	  const double membership = tupleIt->second;
+	  const double membership = memberships[*tupleIdIt];
 	  if (membership > lowestMembershipInMinimalNSet)
 	    {
 	      highestMembershipValues.erase(highestMembershipValues.begin());
@@ -157,21 +218,48 @@ void NoisyTuples::clearIfTooNoisy(const unsigned int dimensionId, const unsigned
 	  minNoise -= highestMembershipValue;
 	}
     }
-  if (minNoise > epsilonVector[dimensionId])
+  return minNoise > epsilonVector[dimensionId];
+}
+
+void NoisyTuples::eraseTuplesInClearedHyperplanes(const unsigned int dimensionId)
+{
+  tupleIds.erase(remove_if(tupleIds.begin(), tupleIds.end(), [dimensionId](const unsigned int tupleId) { return inHyperplaneClearedBefore(tupleId, dimensionId, numeric_limits<unsigned int>::max()); }), tupleIds.end());
+}
+
+void NoisyTuples::markCleared(const unsigned int dimensionId, const unsigned int hyperplaneId, vector<pair<unsigned int, unsigned int>>& hyperplanesToClearNow)
+{
+  hyperplanes[dimensionId][hyperplaneId]->lowestMembershipInMinimalNSet = 3; // To never test again if this hyperplane is too noisy
+  clearingIterations[dimensionId][hyperplaneId] = clearingIteration;
+  dimensions[dimensionId]->decrementCardinality();
+  hyperplanesToClearNow.push_back(pair<unsigned int, unsigned int>(dimensionId, hyperplaneId));
+}
+
+void NoisyTuples::clearIfTooNoisy(const unsigned int dimensionId, const unsigned int hyperplaneId)
+{
+  if (tooNoisy(dimensionId))
     {
-      // This hyperplane cannot possibly be in a pattern respecting the minimal size constraints: clear it
+      // This hyperplane cannot possibly be in a pattern respecting the minimal size constraints: clear it (and the symmetric hyperplanes)
+      ++clearingIteration;
+      vector<pair<unsigned int, unsigned int>> hyperplanesToClearNow;
       if (dimensions[dimensionId]->symmetric())
 	{
 	  for (const unsigned int symDimensionId : symDimensionIds)
 	    {
-	      hyperplanes[symDimensionId][hyperplaneId]->lowestMembershipInMinimalNSet = 3; // To never test again if the any of the symmetric hyperplane is too noisy
-	      hyperplanes[symDimensionId][hyperplaneId]->clear(symDimensionId, hyperplaneId);
+	      markCleared(symDimensionId, hyperplaneId, hyperplanesToClearNow);
 	    }
 	}
       else
 	{
-	  lowestMembershipInMinimalNSet = 3; // To never test again if this hyperplane is too noisy
-	  clear(dimensionId, hyperplaneId);
+	  markCleared(dimensionId, hyperplaneId, hyperplanesToClearNow);
+	}
+      vector<pair<unsigned int, unsigned int>> hyperplanesToCheck;
+      for (const pair<unsigned int, unsigned int>& hyperplane : hyperplanesToClearNow)
+	{
+	  hyperplanes[hyperplane.first][hyperplane.second]->clear(hyperplane.first, hyperplane.second, hyperplanesToCheck);
+	}
+      for (const pair<unsigned int, unsigned int>& hyperplane : hyperplanesToCheck)
+	{
+	  hyperplanesToClear[hyperplane.first].insert(hyperplane.second);
 	}
     }
 }
@@ -182,9 +270,12 @@ vector<Dimension*> NoisyTuples::preProcess(const vector<unsigned int>& nbOfTuple
   epsilonVector = epsilonVectorParam;
   symDimensionIds = symDimensionIdsParam;
   hyperplanes = hyperplanesParam;
-  const unsigned int n = hyperplanes.size();
+  n = hyperplanes.size();
   dimensions.reserve(n);
   hyperplanesToClear.resize(n);
+  clearingIterations.clear();
+  clearingIterations.reserve(n);
+  clearingIteration = 0;
   // Consider the dimensions in decreasing order of (minimalNbOfTuples - epsilon) / nbOfTuples
   vector<pair<double, unsigned int>> order;
   order.reserve(n);
@@ -206,9 +297,52 @@ vector<Dimension*> NoisyTuples::preProcess(const vector<unsigned int>& nbOfTuple
 	{
 	  dimensions.push_back(new Dimension(dimensionId, hyperplanesInDimensionIt->size(), false));
 	}
+      clearingIterations.push_back(vector<unsigned int>(hyperplanesInDimensionIt->size(), numeric_limits<unsigned int>::max()));
       ++hyperplanesInDimensionIt;
     }
   sort(order.begin(), order.end());
+  WorkStealingPool pool(nbOfThreads);
+  if (nbOfThreads != 1)
+    {
+      vector<pair<unsigned int, unsigned int>> hyperplanesToCheck;
+      for (const pair<double, unsigned int>& orderPair : order)
+	{
+	  if (minimalNbOfTuples[orderPair.second] != 0)
+	    {
+	      const unsigned int nbOfHyperplanes = hyperplanes[orderPair.second].size();
+	      for (unsigned int hyperplaneId = 0; hyperplaneId != nbOfHyperplanes; ++hyperplaneId)
+		{
+		  hyperplanesToCheck.push_back(pair<unsigned int, unsigned int>(orderPair.second, hyperplaneId));
+		}
+	    }
+	}
+      preProcessInParallel(pool, hyperplanesToCheck);
+    }
+  else
+    {
+      preProcessSequentially(order);
+    }
+  // Erase the ids of the tuples in cleared hyperplanes from the remaining hyperplanes
+  for (unsigned int dimensionId = 0; dimensionId != n; ++dimensionId)
+    {
+      vector<NoisyTuples*>& hyperplanesInDimension = hyperplanes[dimensionId];
+      runInParallel(pool, hyperplanesInDimension.size(), [&hyperplanesInDimension, dimensionId](const unsigned int begin, const unsigned int end, const unsigned int taskId)
+		    {
+		      for (unsigned int hyperplaneId = begin; hyperplaneId != end; ++hyperplaneId)
+			{
+			  if (hyperplanesInDimension[hyperplaneId]->lowestMembershipInMinimalNSet != 3)
+			    {
+			      hyperplanesInDimension[hyperplaneId]->eraseTuplesInClearedHyperplanes(dimensionId);
+			    }
+			}
+		    });
+    }
+  // PERF: Clear in a tau-contiguous dimension too small sets of elements that are more than tau-far distant from any other element in the dimension
+  return dimensions;
+}
+
+void NoisyTuples::preProcessSequentially(const vector<pair<double, unsigned int>>& order)
+{
   for (const pair<double, unsigned int>& orderPair : order)
     {
       if (minimalNbOfTuples[orderPair.second] != 0)
@@ -253,8 +387,87 @@ vector<Dimension*> NoisyTuples::preProcess(const vector<unsigned int>& nbOfTuple
 	  orderIt = order.begin();
 	}
     }
-  // PERF: Clear in a tau-contiguous dimension too small sets of elements that are more than tau-far distant from any other element in the dimension
-  return dimensions;
+}
+
+// The hyperplanes to check are checked in parallel, those that are too noisy are cleared in parallel and the hyperplanes that lost one of the highest memberships are to be checked at the next iteration; the result is that of the sequential pre-process, the largest subrelation without any too noisy hyperplane
+void NoisyTuples::preProcessInParallel(WorkStealingPool& pool, vector<pair<unsigned int, unsigned int>>& hyperplanesToCheck)
+{
+  vector<vector<pair<unsigned int, unsigned int>>> hyperplanesToCheckPerTask(4 * nbOfThreads);
+  while (!hyperplanesToCheck.empty())
+    {
+      // Check
+      vector<char> areTooNoisy(hyperplanesToCheck.size());
+      runInParallel(pool, hyperplanesToCheck.size(), [&hyperplanesToCheck, &areTooNoisy](const unsigned int begin, const unsigned int end, const unsigned int taskId)
+		    {
+		      for (unsigned int index = begin; index != end; ++index)
+			{
+			  const pair<unsigned int, unsigned int>& hyperplane = hyperplanesToCheck[index];
+			  areTooNoisy[index] = hyperplanes[hyperplane.first][hyperplane.second]->tooNoisy(hyperplane.first);
+			}
+		    });
+      // Mark the hyperplanes to clear, so that the tuples they lose are not notified to them
+      ++clearingIteration;
+      vector<pair<unsigned int, unsigned int>> hyperplanesToClearNow;
+      vector<char>::const_iterator isTooNoisyIt = areTooNoisy.begin();
+      for (const pair<unsigned int, unsigned int>& hyperplane : hyperplanesToCheck)
+	{
+	  if (*isTooNoisyIt++)
+	    {
+	      if (dimensions[hyperplane.first]->symmetric())
+		{
+		  for (const unsigned int symDimensionId : symDimensionIds)
+		    {
+		      if (hyperplanes[symDimensionId][hyperplane.second]->lowestMembershipInMinimalNSet != 3)
+			{
+			  markCleared(symDimensionId, hyperplane.second, hyperplanesToClearNow);
+			}
+		    }
+		}
+	      else
+		{
+		  markCleared(hyperplane.first, hyperplane.second, hyperplanesToClearNow);
+		}
+	    }
+	}
+      // Clear
+      runInParallel(pool, hyperplanesToClearNow.size(), [&hyperplanesToClearNow, &hyperplanesToCheckPerTask](const unsigned int begin, const unsigned int end, const unsigned int taskId)
+		    {
+		      for (unsigned int index = begin; index != end; ++index)
+			{
+			  const pair<unsigned int, unsigned int>& hyperplane = hyperplanesToClearNow[index];
+			  hyperplanes[hyperplane.first][hyperplane.second]->clear(hyperplane.first, hyperplane.second, hyperplanesToCheckPerTask[taskId]);
+			}
+		    });
+      // Gather the hyperplanes to check again, without duplicates nor cleared hyperplanes
+      hyperplanesToCheck.clear();
+      for (vector<pair<unsigned int, unsigned int>>& hyperplanesToCheckInTask : hyperplanesToCheckPerTask)
+	{
+	  hyperplanesToCheck.insert(hyperplanesToCheck.end(), hyperplanesToCheckInTask.begin(), hyperplanesToCheckInTask.end());
+	  hyperplanesToCheckInTask.clear();
+	}
+      sort(hyperplanesToCheck.begin(), hyperplanesToCheck.end());
+      hyperplanesToCheck.erase(unique(hyperplanesToCheck.begin(), hyperplanesToCheck.end()), hyperplanesToCheck.end());
+      hyperplanesToCheck.erase(remove_if(hyperplanesToCheck.begin(), hyperplanesToCheck.end(), [](const pair<unsigned int, unsigned int>& hyperplane) { return hyperplanes[hyperplane.first][hyperplane.second]->lowestMembershipInMinimalNSet == 3; }), hyperplanesToCheck.end());
+    }
+}
+
+void NoisyTuples::runInParallel(WorkStealingPool& pool, const unsigned int nbOfItems, const std::function<void(const unsigned int, const unsigned int, const unsigned int)>& task)
+{
+  const unsigned int nbOfTasks = 4 * nbOfThreads;
+  const unsigned int nbOfItemsPerTask = nbOfItems / nbOfTasks + 1;
+  unsigned int taskId = 0;
+  for (unsigned int begin = 0; begin < nbOfItems; begin += nbOfItemsPerTask)
+    {
+      const unsigned int end = min(begin + nbOfItemsPerTask, nbOfItems);
+      pool.submit([&task, begin, end, taskId]() { task(begin, end, taskId); });
+      ++taskId;
+    }
+  pool.wait();
+}
+
+void NoisyTuples::setNbOfThreads(const unsigned int nbOfThreadsParam)
+{
+  nbOfThreads = nbOfThreadsParam;
 }
 
 // Order the new ids by increasing total membership to take advantage of the prefetch buffer
@@ -277,9 +490,9 @@ vector<unsigned int> NoisyTuples::createNewIds(const vector<unsigned int>& symDi
 	{
 	  if (hyperplane->lowestMembershipInMinimalNSet != 3)
 	    {
-	      for (const pair<vector<unsigned int>, double>& tuple : hyperplane->tuples)
+	      for (const unsigned int tupleId : hyperplane->tupleIds)
 		{
-		  id2TotalMembershipIt->second += tuple.second;
+		  id2TotalMembershipIt->second += memberships[tupleId];
 		}
 	      ++id2TotalMembershipIt;
 	    }
@@ -317,9 +530,9 @@ vector<pair<unsigned int, double>> NoisyTuples::getIds2TotalMemberships(const ve
       if (hyperplane->lowestMembershipInMinimalNSet != 3)
 	{
 	  double totalMembership = 0;
-	  for (const pair<vector<unsigned int>, double>& tuple : hyperplane->tuples)
+	  for (const unsigned int tupleId : hyperplane->tupleIds)
 	    {
-	      totalMembership += tuple.second;
+	      totalMembership += memberships[tupleId];
 	    }
 	  ids2TotalMemberships.push_back(pair<unsigned int, double>(hyperplaneId, totalMembership));
 	}
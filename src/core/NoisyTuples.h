@@ -13,47 +13,67 @@
 
 #include <set>
 #include <unordered_set>
-#include <unordered_map>
 #include <algorithm>
+#include <limits>
 #include <boost/lexical_cast.hpp>
 
-#include "../utilities/vector_hash.h"
+#include "../utilities/WorkStealingPool.h"
 #include "Dimension.h"
 
 using namespace std;
 using namespace boost;
 
+/* A hyperplane of the data, i.e., the ids of its tuples, which are stored once, packed in an arena shared by the hyperplanes of all dimensions */
 class NoisyTuples
 {
  public:
   NoisyTuples();
 
   const bool empty() const;
-  unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator begin() const;  
-  unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator end() const;  
+  vector<unsigned int>::const_iterator begin() const;
+  vector<unsigned int>::const_iterator end() const;
 
-  void insert(const vector<unsigned int>& tuple, const double membership);
+  void insert(const unsigned int tupleId);
 
+  static const unsigned int newTuple(const vector<unsigned int>& tuple, const double membership); /* returns the id of the tuple */
+  static void getTuple(const unsigned int tupleId, vector<unsigned int>& tuple);
+  static const double getMembership(const unsigned int tupleId);
+  static void eraseDuplicates(vector<vector<NoisyTuples*>>& hyperplanes); /* the last membership of a repeated tuple prevails */
+  static void deleteTuples();
+  static void setNbOfThreads(const unsigned int nbOfThreads);
   static vector<Dimension*> preProcess(const vector<unsigned int>& nbOfTuples, const vector<unsigned int>& minimalNbOfTuples, const vector<double>& epsilonVector, const vector<unsigned int>& symDimensionIds, vector<vector<NoisyTuples*>>& hyperplanes);
   static vector<unsigned int> createNewIds(const vector<NoisyTuples*>& hyperplanesInDimension, const unsigned int nbOfValidHyperplanes); /* for regular attributes */
   static vector<unsigned int> createNewIds(const vector<unsigned int>& symDimensionIdsParam, const vector<vector<NoisyTuples*>>& hyperplanesParam, const unsigned int nbOfValidHyperplanes); /* for symmetric attributes */
   static vector<unsigned int> createNewIds(const vector<NoisyTuples*>& hyperplanesInDimension, const unsigned int nbOfValidHyperplanes, const vector<string>& numericLabels); /* for metric attributes */
   
  protected:
-  unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>> tuples;
+  vector<unsigned int> tupleIds;
   double lowestMembershipInMinimalNSet; /* 2 when the hyperplane is unprocessed; 3 when currently/already cleared */
 
+  static unsigned int nbOfThreads;
+  static unsigned int n;
+  static vector<unsigned int> tuples; /* n ids per tuple */
+  static vector<double> memberships; /* 0 for a repeated tuple that was overwritten */
+
   static vector<unsigned int> minimalNbOfTuples;
   static vector<double> epsilonVector;
   static vector<unsigned int> symDimensionIds;
   static vector<vector<NoisyTuples*>> hyperplanes;
   static vector<Dimension*> dimensions;
   static vector<unordered_set<unsigned int>> hyperplanesToClear;
+  static vector<vector<unsigned int>> clearingIterations; /* for every dimension, for every hyperplane, the iteration of the pre-process that cleared it, numeric_limits<unsigned int>::max() if not cleared */
+  static unsigned int clearingIteration;
 
-  const bool erase(const vector<unsigned int>& tuple); /* returns whether the (already processed) hyperplane should be checked again */
-  void clear(const unsigned int dimensionId, const unsigned int hyperplaneId);
+  void clear(const unsigned int dimensionId, const unsigned int hyperplaneId, vector<pair<unsigned int, unsigned int>>& hyperplanesToCheck); /* appends the (already processed) hyperplanes that lost one of their highest memberships to hyperplanesToCheck */
+  const bool tooNoisy(const unsigned int dimensionId); /* also erases the ids of the tuples in cleared orthogonal hyperplanes */
   void clearIfTooNoisy(const unsigned int dimensionId, const unsigned int hyperplaneId);
+  void eraseTuplesInClearedHyperplanes(const unsigned int dimensionId);
 
+  static const bool inHyperplaneClearedBefore(const unsigned int tupleId, const unsigned int dimensionId, const unsigned int iteration); /* ignoring the hyperplane of the tuple in dimensionId */
+  static void markCleared(const unsigned int dimensionId, const unsigned int hyperplaneId, vector<pair<unsigned int, unsigned int>>& hyperplanesToClearNow);
+  static void preProcessSequentially(const vector<pair<double, unsigned int>>& order);
+  static void preProcessInParallel(WorkStealingPool& pool, vector<pair<unsigned int, unsigned int>>& hyperplanesToCheck);
+  static void runInParallel(WorkStealingPool& pool, const unsigned int nbOfItems, const std::function<void(const unsigned int, const unsigned int, const unsigned int)>& task); /* task is given a range of items and an id in [0, 4 * nbOfThreads) */
   static vector<pair<unsigned int, double>> getIds2TotalMemberships(const vector<NoisyTuples*>& hyperplanesInDimension, const unsigned int nbOfValidHyperplanes);
 };
 
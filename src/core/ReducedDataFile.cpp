@@ -0,0 +1,214 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "ReducedDataFile.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "../utilities/MappedFile.h"
+#include "../utilities/DataFormatException.h"
+#include "../utilities/UsageException.h"
+
+const char ReducedDataFile::magic[8] = {'\x89', 'M', 'D', 'R', '\r', '\n', '\x1a', '\n'};
+
+ReducedDataFile::ReducedDataFile(const vector<double>& epsilonVector, const vector<unsigned int>& cliqueDimensions, const vector<double>& tauVector, const vector<unsigned int>& minSizes, const unsigned int minArea, const bool isAgglomeration): internal2ExternalAttributeOrder(), cardinalities(), epsilons(), minSizes(), labels(), labels2Ids(), isCrisp(true), tuples(), memberships(), epsilonVectorParam(epsilonVector), cliqueDimensionsParam(cliqueDimensions), tauVectorParam(tauVector), minSizesParam(minSizes), minAreaParam(minArea), isAgglomerationParam(isAgglomeration)
+{
+}
+
+void ReducedDataFile::addTuple(const unsigned int hyperplaneId, const vector<unsigned int>& tuple, const double membership, const vector<unsigned int>& attributeOrder, const vector<vector<unsigned int>>& oldIds2NewIds)
+{
+  tuples.push_back(hyperplaneId);
+  vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt = oldIds2NewIds.begin();
+  for (const unsigned int attributeId : attributeOrder)
+    {
+      tuples.push_back((++oldIds2NewIdsIt)->at(tuple[attributeId]));
+    }
+  memberships.push_back(membership);
+}
+
+template<typename T> static void writeValue(ofstream& file, const T& value)
+{
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T> static void writeVector(ofstream& file, const vector<T>& values)
+{
+  writeValue(file, static_cast<unsigned long long>(values.size()));
+  file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+static void writeString(ofstream& file, const string& value)
+{
+  writeValue(file, static_cast<unsigned long long>(value.size()));
+  file.write(value.data(), value.size());
+}
+
+template<typename T> static void readValue(const char*& it, const char* end, T& value)
+{
+  if (static_cast<unsigned long long>(end - it) < sizeof(T))
+    {
+      throw DataFormatException("truncated");
+    }
+  memcpy(&value, it, sizeof(T));
+  it += sizeof(T);
+}
+
+template<typename T> static void readVector(const char*& it, const char* end, vector<T>& values)
+{
+  unsigned long long size;
+  readValue(it, end, size);
+  if (size > static_cast<unsigned long long>(end - it) / sizeof(T))
+    {
+      throw DataFormatException("truncated");
+    }
+  values.resize(size);
+  if (size != 0)
+    {
+      // The values are not necessarily aligned in the file, hence memcpy
+      memcpy(values.data(), it, size * sizeof(T));
+    }
+  it += size * sizeof(T);
+}
+
+static void readString(const char*& it, const char* end, string& value)
+{
+  unsigned long long size;
+  readValue(it, end, size);
+  if (size > static_cast<unsigned long long>(end - it))
+    {
+      throw DataFormatException("truncated");
+    }
+  value.assign(it, size);
+  it += size;
+}
+
+void ReducedDataFile::read(const char* fileName)
+{
+  const MappedFile file(fileName);
+  const char* it = file.begin();
+  const char* end = file.end();
+  if (static_cast<unsigned long long>(end - it) < sizeof(magic) || memcmp(it, magic, sizeof(magic)) != 0)
+    {
+      throw DataFormatException((string(fileName) + " is not a reduced data file!").c_str());
+    }
+  it += sizeof(magic);
+  try
+    {
+      vector<double> savedEpsilonVector;
+      vector<unsigned int> savedCliqueDimensions;
+      vector<double> savedTauVector;
+      vector<unsigned int> savedMinSizes;
+      unsigned int savedMinArea;
+      bool savedIsAgglomeration;
+      readVector(it, end, savedEpsilonVector);
+      readVector(it, end, savedCliqueDimensions);
+      readVector(it, end, savedTauVector);
+      readVector(it, end, savedMinSizes);
+      readValue(it, end, savedMinArea);
+      readValue(it, end, savedIsAgglomeration);
+      if (savedEpsilonVector != epsilonVectorParam || savedCliqueDimensions != cliqueDimensionsParam || savedTauVector != tauVectorParam || savedMinSizes != minSizesParam || savedMinArea != minAreaParam || savedIsAgglomeration != isAgglomerationParam)
+	{
+	  throw UsageException((string(fileName) + " was written with other epsilon, clique, tau, sizes, area or agglomeration options!").c_str());
+	}
+      readVector(it, end, internal2ExternalAttributeOrder);
+      readVector(it, end, cardinalities);
+      readVector(it, end, epsilons);
+      readVector(it, end, minSizes);
+      const unsigned int n = internal2ExternalAttributeOrder.size();
+      labels.resize(n);
+      labels2Ids.resize(n);
+      vector<vector<string>>::iterator labelsIt = labels.begin();
+      for (unordered_map<string, unsigned int>& labels2IdsInAttribute : labels2Ids)
+	{
+	  unsigned long long nbOfLabels;
+	  readValue(it, end, nbOfLabels);
+	  if (nbOfLabels > static_cast<unsigned long long>(end - it) / sizeof(unsigned long long))
+	    {
+	      throw DataFormatException("truncated");
+	    }
+	  labelsIt->resize(nbOfLabels);
+	  for (string& label : *labelsIt)
+	    {
+	      readString(it, end, label);
+	    }
+	  ++labelsIt;
+	  unsigned long long nbOfLabels2Ids;
+	  readValue(it, end, nbOfLabels2Ids);
+	  if (nbOfLabels2Ids > static_cast<unsigned long long>(end - it) / (sizeof(unsigned long long) + sizeof(unsigned int)))
+	    {
+	      throw DataFormatException("truncated");
+	    }
+	  labels2IdsInAttribute.reserve(nbOfLabels2Ids);
+	  for (; nbOfLabels2Ids != 0; --nbOfLabels2Ids)
+	    {
+	      string label;
+	      unsigned int id;
+	      readString(it, end, label);
+	      readValue(it, end, id);
+	      labels2IdsInAttribute[label] = id;
+	    }
+	}
+      readValue(it, end, isCrisp);
+      readVector(it, end, tuples);
+      readVector(it, end, memberships);
+      if (cardinalities.size() != n || epsilons.size() != n || minSizes.size() != n || (n != 0 && tuples.size() != memberships.size() * n))
+	{
+	  throw DataFormatException("truncated");
+	}
+    }
+  catch (DataFormatException&)
+    {
+      throw DataFormatException((string(fileName) + " is a truncated reduced data file!").c_str());
+    }
+}
+
+void ReducedDataFile::write(const char* fileName) const
+{
+  ofstream file(fileName, ios::binary);
+  if (!file)
+    {
+      throw NoFileException(fileName);
+    }
+  file.write(magic, sizeof(magic));
+  writeVector(file, epsilonVectorParam);
+  writeVector(file, cliqueDimensionsParam);
+  writeVector(file, tauVectorParam);
+  writeVector(file, minSizesParam);
+  writeValue(file, minAreaParam);
+  writeValue(file, isAgglomerationParam);
+  writeVector(file, internal2ExternalAttributeOrder);
+  writeVector(file, cardinalities);
+  writeVector(file, epsilons);
+  writeVector(file, minSizes);
+  vector<vector<string>>::const_iterator labelsIt = labels.begin();
+  for (const unordered_map<string, unsigned int>& labels2IdsInAttribute : labels2Ids)
+    {
+      writeValue(file, static_cast<unsigned long long>(labelsIt->size()));
+      for (const string& label : *labelsIt)
+	{
+	  writeString(file, label);
+	}
+      ++labelsIt;
+      writeValue(file, static_cast<unsigned long long>(labels2IdsInAttribute.size()));
+      for (const pair<const string, unsigned int>& label2Id : labels2IdsInAttribute)
+	{
+	  writeString(file, label2Id.first);
+	  writeValue(file, label2Id.second);
+	}
+    }
+  writeValue(file, isCrisp);
+  writeVector(file, tuples);
+  writeVector(file, memberships);
+  if (!file)
+    {
+      throw NoFileException(fileName);
+    }
+}
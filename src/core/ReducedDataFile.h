@@ -0,0 +1,52 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef REDUCED_DATA_FILE_H_
+#define REDUCED_DATA_FILE_H_
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+
+using namespace std;
+
+/* Snapshot of the data after the pre-process, in the internal order of the attributes and with the new ids of their elements, so that the runs with the same reduction parameters skip the parsing and the pre-process.  In the byte order of the machine that wrote it. */
+class ReducedDataFile
+{
+ public:
+  vector<unsigned int> internal2ExternalAttributeOrder; /* empty if the pre-process erased all tuples */
+  vector<unsigned int> cardinalities;
+  vector<double> epsilons;
+  vector<unsigned int> minSizes;
+  vector<vector<string>> labels;
+  vector<unordered_map<string, unsigned int>> labels2Ids;
+  bool isCrisp;
+  vector<unsigned int> tuples;	/* n ids each, the first one being that of the hyperplane of the first attribute */
+  vector<double> memberships;
+
+  ReducedDataFile(const vector<double>& epsilonVector, const vector<unsigned int>& cliqueDimensions, const vector<double>& tauVector, const vector<unsigned int>& minSizes, const unsigned int minArea, const bool isAgglomeration);
+
+  void addTuple(const unsigned int hyperplaneId, const vector<unsigned int>& tuple, const double membership, const vector<unsigned int>& attributeOrder, const vector<vector<unsigned int>>& oldIds2NewIds);
+  void read(const char* fileName); /* throws a UsageException if the snapshot was taken with other reduction parameters */
+  void write(const char* fileName) const;
+
+ protected:
+  vector<double> epsilonVectorParam;
+  vector<unsigned int> cliqueDimensionsParam;
+  vector<double> tauVectorParam;
+  vector<unsigned int> minSizesParam;
+  unsigned int minAreaParam;
+  bool isAgglomerationParam;
+
+  static const char magic[8];
+};
+
+#endif /*REDUCED_DATA_FILE_H_*/
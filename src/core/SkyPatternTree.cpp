@@ -17,7 +17,7 @@ unordered_set<IndistinctSkyPatterns*, skyPatternHasher, skyPatternEqual> SkyPatt
 bool SkyPatternTree::isSomeOptimizedMeasureNotMonotone;
 bool SkyPatternTree::isIntermediateSkylinePrinted;
 
-SkyPatternTree::SkyPatternTree(const char* dataFileName, const float densityThreshold, const double shiftMultiplier, const vector<double>& epsilonVectorParam, const vector<unsigned int>& cliqueDimensionsParam, const vector<double>& tauVectorParam, const vector<unsigned int>& minSizesParam, const unsigned int minAreaParam, const bool isReductionOnly, const bool isAgglomerationParam, const vector<unsigned int>& unclosedDimensions, const char* inputElementSeparator, const char* inputDimensionSeparator, const char* outputFileName, const char* outputDimensionSeparatorParam, const char* patternSizeSeparatorParam, const char* sizeSeparatorParam, const char* sizeAreaSeparatorParam, const bool isSizePrintedParam, const bool isAreaPrintedParam, const bool isIntermediateSkylinePrintedParam) : Tree(dataFileName, densityThreshold, shiftMultiplier, epsilonVectorParam, cliqueDimensionsParam, tauVectorParam, minSizesParam, minAreaParam, isReductionOnly, isAgglomerationParam, unclosedDimensions, inputElementSeparator, inputDimensionSeparator, outputFileName, outputDimensionSeparatorParam, patternSizeSeparatorParam, sizeSeparatorParam, sizeAreaSeparatorParam, isSizePrintedParam, isAreaPrintedParam), measuresToMaximize()
+SkyPatternTree::SkyPatternTree(const char* dataFileName, const float densityThreshold, const double shiftMultiplier, const vector<double>& epsilonVectorParam, const vector<unsigned int>& cliqueDimensionsParam, const vector<double>& tauVectorParam, const vector<unsigned int>& minSizesParam, const unsigned int minAreaParam, const bool isReductionOnly, const char* savedReducedDataFileName, const char* loadedReducedDataFileName, const bool isAgglomerationParam, const vector<unsigned int>& unclosedDimensions, const char* inputElementSeparator, const char* inputDimensionSeparator, const char* outputFileName, const char* outputDimensionSeparatorParam, const char* patternSizeSeparatorParam, const char* sizeSeparatorParam, const char* sizeAreaSeparatorParam, const bool isSizePrintedParam, const bool isAreaPrintedParam, const bool isOutputBinaryParam, const bool isIntermediateSkylinePrintedParam) : Tree(dataFileName, densityThreshold, shiftMultiplier, epsilonVectorParam, cliqueDimensionsParam, tauVectorParam, minSizesParam, minAreaParam, isReductionOnly, savedReducedDataFileName, loadedReducedDataFileName, isAgglomerationParam, unclosedDimensions, inputElementSeparator, inputDimensionSeparator, outputFileName, outputDimensionSeparatorParam, patternSizeSeparatorParam, sizeSeparatorParam, sizeAreaSeparatorParam, isSizePrintedParam, isAreaPrintedParam, isOutputBinaryParam), measuresToMaximize()
 {
   isIntermediateSkylinePrinted = isIntermediateSkylinePrintedParam;
 }
@@ -32,7 +32,7 @@ SkyPatternTree::~SkyPatternTree()
   deleteMeasures(measuresToMaximize);
 }
 
-const bool SkyPatternTree::leftSubtree(const Attribute& presentAttribute) const
+const bool SkyPatternTree::leftSubtree(const Attribute& presentAttribute)
 {
   const unsigned int presentAttributeId = presentAttribute.getId();
   const unsigned int valueId = presentAttribute.getChosenValue().getDataId();
@@ -53,9 +53,18 @@ const bool SkyPatternTree::leftSubtree(const Attribute& presentAttribute) const
       deleteMeasures(childMeasuresToMaximize);
       return true;
     }
+#ifdef TRAIL
+  measuresToMaximize.swap(childMeasuresToMaximize);
+  const bool isLeftChildEnumeratedElementPotentiallyPreventingClosedness = setPresentInPlace(presentAttributeId, childMereConstraints);
+  measuresToMaximize.swap(childMeasuresToMaximize);
+  deleteMeasures(childMeasuresToMaximize);
+  deleteMeasures(childMereConstraints);
+  return isLeftChildEnumeratedElementPotentiallyPreventingClosedness;
+#else
   SkyPatternTree leftChild(*this, childMereConstraints, childMeasuresToMaximize);
   leftChild.setPresent(presentAttributeId);
   return leftChild.isEnumeratedElementPotentiallyPreventingClosedness;
+#endif
 }
 
 void SkyPatternTree::initMeasures(const vector<unsigned int>& maxSizesParam, const int maxArea, const vector<unsigned int>& maximizedSizeDimensionsParam, const vector<unsigned int>& minimizedSizeDimensionsParam, const bool isAreaMaximized, const bool isAreaMinimized, const vector<string>& groupFileNames, const vector<unsigned int>& groupMinSizesParam, const vector<unsigned int>& groupMaxSizes, const vector<vector<float>>& groupMinRatios, const vector<vector<float>>& groupMinPiatetskyShapiros, const vector<vector<float>>& groupMinLeverages, const vector<vector<float>>& groupMinForces, const vector<vector<float>>& groupMinYulesQs, const vector<vector<float>>& groupMinYulesYs, const char* groupElementSeparator, const char* groupDimensionElementsSeparator, vector<unsigned int>& groupMaximizedSizes, const vector<unsigned int>& groupMinimizedSizes, const vector<vector<float>>& groupMaximizedRatios, const vector<vector<float>>& groupMaximizedPiatetskyShapiros, const vector<vector<float>>& groupMaximizedLeverages, const vector<vector<float>>& groupMaximizedForces, const vector<vector<float>>& groupMaximizedYulesQs, const vector<vector<float>>& groupMaximizedYulesYs, const char* utilityValueFileName, const float minUtility, const char* valueElementSeparator, const char* valueDimensionSeparator, const bool isUtilityMaximized, const char* slopePointFileName, const float minSlope, const char* pointElementSeparator, const char* pointDimensionSeparator, const bool isSlopeMaximized, const float densityThreshold)
@@ -753,7 +762,14 @@ void SkyPatternTree::terminate(const double maximalNbOfCandidateAgglomerates)
       for (IndistinctSkyPatterns* indistinctSkyPatterns : skyPatterns)
 	{
 #ifdef OUTPUT
-	  printNSets(indistinctSkyPatterns->getPatterns(), outputFile);
+	  if (isOutputBinary)
+	    {
+	      writeNSets(indistinctSkyPatterns->getPatterns(), outputFile.stream());
+	    }
+	  else
+	    {
+	      printNSets(indistinctSkyPatterns->getPatterns(), outputFile.stream());
+	    }
 #endif
 	  delete indistinctSkyPatterns;
 	}
@@ -1104,3 +1120,21 @@ void SkyPatternTree::printNSets(const vector<vector<vector<unsigned int>>>& nSet
       out << endl;
     }
 }
+
+void SkyPatternTree::writeNSets(const vector<vector<vector<unsigned int>>>& nSets, ostream& out) const
+{
+  for (const vector<vector<unsigned int>>& nSet : nSets)
+    {
+      unsigned long long area = 1;
+      for (const vector<unsigned int>& dimension : nSet)
+	{
+	  area *= dimension.size();
+	}
+      BinaryPatternFile::writeArea(area, out);
+      for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
+	{
+	  BinaryPatternFile::writeIds(nSet[internalAttributeId], out);
+	}
+      out.flush();
+    }
+}
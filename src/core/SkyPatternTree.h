@@ -36,7 +36,7 @@ class SkyPatternTree: public Tree
   SkyPatternTree() = delete;
   SkyPatternTree(const SkyPatternTree&) = delete;
   SkyPatternTree(SkyPatternTree&&) = delete;
-  SkyPatternTree(const char* dataFileName, const float densityThreshold, const double shiftMultiplier, const vector<double>& epsilonVector, const vector<unsigned int>& cliqueDimensions, const vector<double>& tauVector, const vector<unsigned int>& minSizes, const unsigned int minArea, const bool isReductionOnly, const bool isAgglomeration, const vector<unsigned int>& unclosedDimensions, const char* inputElementSeparator, const char* inputDimensionSeparator, const char* outputFileName, const char* outputDimensionSeparator, const char* patternSizeSeparator, const char* sizeSeparator, const char* sizeAreaSeparator, const bool isSizePrinted, const bool isAreaPrinted, const bool isIntermediateSkylinePrinted);
+  SkyPatternTree(const char* dataFileName, const float densityThreshold, const double shiftMultiplier, const vector<double>& epsilonVector, const vector<unsigned int>& cliqueDimensions, const vector<double>& tauVector, const vector<unsigned int>& minSizes, const unsigned int minArea, const bool isReductionOnly, const char* savedReducedDataFileName, const char* loadedReducedDataFileName, const bool isAgglomeration, const vector<unsigned int>& unclosedDimensions, const char* inputElementSeparator, const char* inputDimensionSeparator, const char* outputFileName, const char* outputDimensionSeparator, const char* patternSizeSeparator, const char* sizeSeparator, const char* sizeAreaSeparator, const bool isSizePrinted, const bool isAreaPrinted, const bool isOutputBinary, const bool isIntermediateSkylinePrinted);
 
   ~SkyPatternTree();
 
@@ -58,7 +58,7 @@ class SkyPatternTree: public Tree
 
   SkyPatternTree(const SkyPatternTree& parent, const vector<Measure*>& mereConstraints, const vector<Measure*>& measuresToMaximize);
 
-  const bool leftSubtree(const Attribute& presentAttribute) const;
+  const bool leftSubtree(const Attribute& presentAttribute);
 
   const bool violationAfterAdding(const unsigned int dimensionIdOfElementsSetPresent, const vector<unsigned int>& elementsSetPresent);
   const bool violationAfterRemoving(const unsigned int dimensionIdOfElementsSetAbsent, const vector<unsigned int>& elementsSetAbsent);
@@ -68,6 +68,7 @@ class SkyPatternTree: public Tree
 #endif
   void validPattern() const;
   void printNSets(const vector<vector<vector<unsigned int>>>& nSets, ostream& out) const;
+  void writeNSets(const vector<vector<vector<unsigned int>>>& nSets, ostream& out) const;
 
   static const bool dominated(const vector<Measure*>& measuresToMaximize);
 };
@@ -0,0 +1,333 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "SortedFuzzyTube.h"
+
+SortedFuzzyTube::SortedFuzzyTube(const vector<pair<unsigned int, unsigned int>>& sortedNoisyHyperplanes) : Tube(sortedFuzzyTubeData), hyperplaneIds(), noises()
+{
+  hyperplaneIds.reserve(sortedNoisyHyperplanes.size());
+  noises.reserve(sortedNoisyHyperplanes.size());
+  for (const pair<unsigned int, unsigned int>& hyperplane : sortedNoisyHyperplanes)
+    {
+      hyperplaneIds.push_back(hyperplane.first);
+      noises.push_back(hyperplane.second);
+    }
+}
+
+SortedFuzzyTube* SortedFuzzyTube::clone() const
+{
+  return new SortedFuzzyTube(*this);
+}
+
+void SortedFuzzyTube::print(vector<unsigned int>& prefix, ostream& out) const
+{
+  vector<unsigned int>::const_iterator noiseIt = noises.begin();
+  for (const unsigned int hyperplaneId : hyperplaneIds)
+    {
+      for (const unsigned int id : prefix)
+	{
+	  out << id << ' ';
+	}
+      out << hyperplaneId << ' ' << 1 - static_cast<double>(*noiseIt++) / Attribute::noisePerUnit << endl;
+    }
+}
+
+const bool SortedFuzzyTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
+{
+  // Never called: the sparse tubes are frozen once every tuple is inserted
+  return false;
+}
+
+const unsigned int SortedFuzzyTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId)
+{
+  // Never called
+  return 0;
+}
+
+const unsigned int SortedFuzzyTube::noiseOnValue(const unsigned int valueDataId) const
+{
+  const vector<unsigned int>::const_iterator hyperplaneIdIt = lower_bound(hyperplaneIds.begin(), hyperplaneIds.end(), valueDataId);
+  if (hyperplaneIdIt == hyperplaneIds.end() || *hyperplaneIdIt != valueDataId)
+    {
+      return Attribute::noisePerUnit;
+    }
+  return noises[hyperplaneIdIt - hyperplaneIds.begin()];
+}
+
+const unsigned int SortedFuzzyTube::noiseOnValues(const vector<Attribute*>::const_iterator attributeIt, const vector<unsigned int>& valueDataIds) const
+{
+  unsigned int oldNoise = 0;
+  for (const unsigned int valueDataId : valueDataIds)
+    {
+      oldNoise += noiseOnValue(valueDataId);
+    }
+  return oldNoise;
+}
+
+const unsigned int SortedFuzzyTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
+{
+  // *this necessarily relates to the present attribute
+  return noiseOnValue((*attributeIt)->getChosenValue().getDataId());
+}
+
+const unsigned int SortedFuzzyTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
+{
+  // *this necessarily relates to the present attribute
+  const Value& presentValue = (*attributeIt)->getChosenValue();
+  const unsigned int noise = noiseOnValue(presentValue.getDataId());
+  Trail::increase((*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()], noise);
+  return noise;
+}
+
+const unsigned int SortedFuzzyTube::presentFixPresentValuesAfterPresentValueMet(Attribute& currentAttribute) const
+{
+  unsigned int newNoise = 0;
+  const vector<Value*>::iterator end = currentAttribute.presentEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
+    {
+      const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      (*valueIt)->addPresentNoise(newNoiseInHyperplane);
+      newNoise += newNoiseInHyperplane;
+    }
+  return newNoise;
+}
+
+const unsigned int SortedFuzzyTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
+{
+  unsigned int newNoise = 0;
+  const vector<Value*>::iterator end = currentAttribute.presentEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
+    {
+      const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], newNoiseInHyperplane);
+      newNoise += newNoiseInHyperplane;
+    }
+  return newNoise;
+}
+
+void SortedFuzzyTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  const vector<Value*>::iterator end = currentAttribute.absentEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
+    {
+      const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      (*valueIt)->addPresentNoise(newNoiseInHyperplane);
+      const unsigned int valueId = (*valueIt)->getIntersectionId();
+      for (Intersections::iterator intersectionIt : intersectionIts)
+	{
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
+	}
+    }
+}
+
+void SortedFuzzyTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  const vector<Value*>::iterator end = currentAttribute.absentEnd();
+  // The first potential value actually is the value set present and there is no noise to be found at the insection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
+  for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); ++valueIt != end; )
+    {
+      const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      (*valueIt)->addPresentNoise(newNoiseInHyperplane);
+      const unsigned int valueId = (*valueIt)->getIntersectionId();
+      for (Intersections::iterator intersectionIt : intersectionIts)
+	{
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
+	}
+    }
+}
+
+const unsigned int SortedFuzzyTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
+{
+  // *this necessarily relates to the absent attribute
+  return noiseOnValues(absentAttributeIt, absentValueDataIds);
+}
+
+const unsigned int SortedFuzzyTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
+{
+  // *this necessarily relates to the absent attribute
+  return noiseOnValues(absentAttributeIt, absentValueDataIds);
+}
+
+const unsigned int SortedFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  unsigned int oldNoise = 0;
+  const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
+    {
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
+      const unsigned int valueId = (*valueIt)->getIntersectionId();
+      for (Intersections::iterator intersectionIt : intersectionIts)
+	{
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
+	}
+      oldNoise += oldNoiseInHyperplane;
+    }
+  return oldNoise;
+}
+
+const unsigned int SortedFuzzyTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  unsigned int oldNoise = 0;
+  vector<Value*>::iterator end = currentAttribute.presentEnd();
+  vector<Value*>::iterator valueIt = currentAttribute.presentBegin();
+  for (; valueIt != end; ++valueIt)
+    {
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
+      const unsigned int valueId = (*valueIt)->getIntersectionId();
+      for (Intersections::iterator intersectionIt : intersectionIts)
+	{
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
+	}
+      oldNoise += oldNoiseInHyperplane;
+    }
+  end = currentAttribute.irrelevantEnd();
+  while (++valueIt != end)
+    {
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
+      const unsigned int valueId = (*valueIt)->getIntersectionId();
+      for (Intersections::iterator intersectionIt : intersectionIts)
+	{
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
+	}
+      oldNoise += oldNoiseInHyperplane;
+    }
+  return oldNoise;
+}
+
+const unsigned int SortedFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
+{
+  unsigned int oldNoise = 0;
+  const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
+    {
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
+      oldNoise += oldNoiseInHyperplane;
+    }
+  return oldNoise;
+}
+
+const unsigned int SortedFuzzyTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
+{
+  unsigned int oldNoise = 0;
+  vector<Value*>::iterator end = currentAttribute.presentEnd();
+  vector<Value*>::iterator valueIt = currentAttribute.presentBegin();
+  for (; valueIt != end; ++valueIt)
+    {
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
+      oldNoise += oldNoiseInHyperplane;
+    }
+  end = currentAttribute.irrelevantEnd();
+  while (++valueIt != end)
+    {
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
+      oldNoise += oldNoiseInHyperplane;
+    }
+  return oldNoise;
+}
+  
+void SortedFuzzyTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
+{
+  const vector<Value*>::iterator end = currentAttribute.absentEnd();
+  for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
+    {
+      const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
+      (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
+      const unsigned int valueId = (*valueIt)->getIntersectionId();
+      for (Intersections::iterator intersectionIt : intersectionIts)
+	{
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
+	}
+    }
+}
+
+const unsigned int SortedFuzzyTube::countNoise(const vector<vector<unsigned int>>::const_iterator dimensionIt) const
+{
+  // The ids in *dimensionIt are sorted: they are merged with hyperplaneIds
+  unsigned int noise = 0;
+  const vector<unsigned int>::const_iterator hyperplaneIdEnd = hyperplaneIds.end();
+  vector<unsigned int>::const_iterator hyperplaneIdIt = hyperplaneIds.begin();
+  for (const unsigned int id : *dimensionIt)
+    {
+      hyperplaneIdIt = gallop(hyperplaneIdIt, hyperplaneIdEnd, id);
+      if (hyperplaneIdIt != hyperplaneIdEnd && *hyperplaneIdIt == id)
+	{
+	  noise += noises[hyperplaneIdIt - hyperplaneIds.begin()];
+	}
+      else
+	{
+	  noise += Attribute::noisePerUnit;
+	}
+    }
+  return noise;
+}
+
+const bool SortedFuzzyTube::decreaseMembershipDownToThreshold(const double membershipThreshold, const vector<vector<unsigned int>>::const_iterator dimensionIt, const vector<vector<unsigned int>::const_iterator>::iterator tupleIt, double& membershipSum) const
+{
+  // The ids in *dimensionIt are sorted: they are merged with hyperplaneIds
+  const vector<unsigned int>::const_iterator hyperplaneIdEnd = hyperplaneIds.end();
+  vector<unsigned int>::const_iterator hyperplaneIdIt = hyperplaneIds.begin();
+  for (; *tupleIt != dimensionIt->end(); ++*tupleIt)
+    {
+      hyperplaneIdIt = gallop(hyperplaneIdIt, hyperplaneIdEnd, **tupleIt);
+      if (hyperplaneIdIt != hyperplaneIdEnd && *hyperplaneIdIt == **tupleIt)
+	{
+	  membershipSum -= noises[hyperplaneIdIt - hyperplaneIds.begin()];
+	}
+      else
+	{
+	  membershipSum -= Attribute::noisePerUnit;
+	}
+      if (membershipSum < membershipThreshold)
+	{
+	  ++*tupleIt;
+	  return true;
+	}
+    }
+  *tupleIt = dimensionIt->begin();
+  return false;
+}
+
+#ifdef ASSERT
+const unsigned int SortedFuzzyTube::countNoiseOnPresent(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const
+{
+  if (attributeIt == valueAttributeIt)
+    {
+      return noiseOnValue(value.getDataId());
+    }
+  unsigned int noise = 0;
+  const vector<Value*>::const_iterator end = (*attributeIt)->presentEnd();
+  for (vector<Value*>::const_iterator valueIt = (*attributeIt)->presentBegin(); valueIt != end; ++valueIt)
+    {
+      noise += noiseOnValue((*valueIt)->getDataId());
+    }
+  return noise;
+}
+
+const unsigned int SortedFuzzyTube::countNoiseOnPresentAndPotential(const vector<Attribute*>::const_iterator valueAttributeIt, const Value& value, const vector<Attribute*>::const_iterator attributeIt) const
+{
+  if (attributeIt == valueAttributeIt)
+    {
+      return noiseOnValue(value.getDataId());
+    }
+  unsigned int noise = 0;
+  vector<Value*>::const_iterator end = (*attributeIt)->irrelevantEnd();
+  for (vector<Value*>::const_iterator valueIt = (*attributeIt)->presentBegin(); valueIt != end; ++valueIt)
+    {
+      noise += noiseOnValue((*valueIt)->getDataId());
+    }
+  return noise;
+}
+#endif
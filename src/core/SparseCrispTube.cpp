@@ -12,7 +12,7 @@
 
 float SparseCrispTube::densityThreshold;
 
-SparseCrispTube::SparseCrispTube() : tube()
+SparseCrispTube::SparseCrispTube() : Tube(sparseCrispTubeData), tube()
 {
 }
 
@@ -33,24 +33,39 @@ void SparseCrispTube::print(vector<unsigned int>& prefix, ostream& out) const
     }
 }
 
-const bool SparseCrispTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts)
+AbstractData* SparseCrispTube::compress()
+{
+#ifdef COMPRESSED_TUBES
+  vector<unsigned int> presentHyperplaneIds(tube.begin(), tube.end());
+  sort(presentHyperplaneIds.begin(), presentHyperplaneIds.end());
+  CompressedCrispTube* compressedTube = new CompressedCrispTube(presentHyperplaneIds);
+  if (compressedTube->sizeInBytes() < sizeof(SparseCrispTube) + (tube.bucket_count() + 2 * tube.size()) * sizeof(unsigned int*))
+    {
+      return compressedTube;
+    }
+  delete compressedTube;
+#endif
+  return this;
+}
+
+const bool SparseCrispTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
 {
   const unsigned int element = oldIds2NewIdsIt->at(tuple[*attributeIdIt]);
   (*attributeIt)->substractPotentialNoise(element, Attribute::noisePerUnit);
-  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+  for (Intersections::iterator intersectionIt : intersectionIts)
     {
-      (*intersectionIt)[element] -= Attribute::noisePerUnit;
+      Trail::decrease((*intersectionIt)[element], Attribute::noisePerUnit);
     }
   tube.insert(element);
   return tube.bucket_count() + 2 * tube.size() * sizeof(unsigned int*) > (*attributeIt)->sizeOfPresentAndPotential() * densityThreshold; // In the worst case (all values in th same bucket), the unordered_set<unsigned int> takes more space than a vector<unsigned int> * densityThreshold
 }
 
-const unsigned int SparseCrispTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, const unsigned int dimensionId)
+const unsigned int SparseCrispTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId)
 {
   // Necessarily symmetric
-  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+  for (Intersections::iterator intersectionIt : intersectionIts)
     {
-      (*intersectionIt)[hyperplaneId] -= Attribute::noisePerUnit;
+      Trail::decrease((*intersectionIt)[hyperplaneId], Attribute::noisePerUnit);
     }
   (*attributeIt)->substractPotentialNoise(hyperplaneId, Attribute::noisePerUnit);
   tube.insert(hyperplaneId);
@@ -80,7 +95,7 @@ const unsigned int SparseCrispTube::noiseOnValues(const vector<Attribute*>::cons
   return oldNoise;
 }
 
-const unsigned int SparseCrispTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int SparseCrispTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the present attribute
   if (tube.find((*attributeIt)->getChosenValue().getDataId()) == tube.end())
@@ -90,25 +105,25 @@ const unsigned int SparseCrispTube::setPresent(const vector<Attribute*>::iterato
   return 0;
 }
 
-const unsigned int SparseCrispTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int SparseCrispTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   // *this necessarily relates to the present attribute
   const Value& presentValue = (*attributeIt)->getChosenValue();
   if (tube.find(presentValue.getDataId()) == tube.end())
     {
-      (*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()] += Attribute::noisePerUnit;
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()], Attribute::noisePerUnit);
       return Attribute::noisePerUnit;
     }
   return 0;
 }
 
-const unsigned int SparseCrispTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int SparseCrispTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the absent attribute
   return noiseOnValues(absentAttributeIt, absentValueDataIds);
 }
 
-const unsigned int SparseCrispTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int SparseCrispTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
   // *this necessarily relates to the absent attribute
   return noiseOnValues(absentAttributeIt, absentValueDataIds);
@@ -129,7 +144,7 @@ const unsigned int SparseCrispTube::presentFixPresentValuesAfterPresentValueMet(
   return newNoise;
 }
 
-const unsigned int SparseCrispTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int SparseCrispTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -137,14 +152,14 @@ const unsigned int SparseCrispTube::presentFixPresentValuesAfterPresentValueMetA
     {
       if (tube.find((*valueIt)->getDataId()) == tube.end())
 	{
-	  (*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()] += Attribute::noisePerUnit;
+	  Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
 	  newNoise += Attribute::noisePerUnit;
 	}
     }
   return newNoise;
 }
 
-void SparseCrispTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void SparseCrispTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
@@ -153,15 +168,15 @@ void SparseCrispTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attr
 	{
 	  (*valueIt)->addPresentNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] += Attribute::noisePerUnit;
+	      Trail::increase((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	}
     }
 }
 
-void SparseCrispTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void SparseCrispTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   // The first potential value actually is the value set present and there is no noise to be found at the insection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
@@ -171,15 +186,15 @@ void SparseCrispTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribut
 	{
 	  (*valueIt)->addPresentNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] += Attribute::noisePerUnit;
+	      Trail::increase((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	}
     }
 }
 
-const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
@@ -189,9 +204,9 @@ const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesAfterAbsent
 	{
 	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] -= Attribute::noisePerUnit;
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	  oldNoise += Attribute::noisePerUnit;
 	}
@@ -199,7 +214,7 @@ const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesAfterAbsent
   return oldNoise;
 }
 
-const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -210,9 +225,9 @@ const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSym
 	{
 	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] -= Attribute::noisePerUnit;
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	  oldNoise += Attribute::noisePerUnit;
 	}
@@ -224,9 +239,9 @@ const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSym
 	{
 	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] -= Attribute::noisePerUnit;
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	  oldNoise += Attribute::noisePerUnit;
 	}
@@ -234,7 +249,7 @@ const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSym
   return oldNoise;
 }
 
-const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
@@ -242,14 +257,14 @@ const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesAfterAbsent
     {
       if (tube.find((*valueIt)->getDataId()) == tube.end())
 	{
-	  (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= Attribute::noisePerUnit;
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
 	  oldNoise += Attribute::noisePerUnit;
 	}
     }
   return oldNoise;
 }
 
-const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -258,7 +273,7 @@ const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSym
     {
       if (tube.find((*valueIt)->getDataId()) == tube.end())
 	{
-	  (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= Attribute::noisePerUnit;
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
 	  oldNoise += Attribute::noisePerUnit;
 	}
     }
@@ -267,14 +282,14 @@ const unsigned int SparseCrispTube::absentFixPresentOrPotentialValuesInSecondSym
     {
       if (tube.find((*valueIt)->getDataId()) == tube.end())
 	{
-	  (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= Attribute::noisePerUnit;
+	  Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], Attribute::noisePerUnit);
 	  oldNoise += Attribute::noisePerUnit;
 	}
     }
   return oldNoise;
 }
 
-void SparseCrispTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void SparseCrispTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
@@ -283,9 +298,9 @@ void SparseCrispTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& curre
 	{
 	  (*valueIt)->substractPotentialNoise(Attribute::noisePerUnit);
 	  const unsigned int valueId = (*valueIt)->getIntersectionId();
-	  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+	  for (Intersections::iterator intersectionIt : intersectionIts)
 	    {
-	      (*intersectionIt)[valueId] -= Attribute::noisePerUnit;
+	      Trail::decrease((*intersectionIt)[valueId], Attribute::noisePerUnit);
 	    }
 	}
     }
@@ -12,7 +12,7 @@
 
 float SparseFuzzyTube::densityThreshold;
 
-SparseFuzzyTube::SparseFuzzyTube() : tube()
+SparseFuzzyTube::SparseFuzzyTube() : Tube(sparseFuzzyTubeData), tube()
 {
 }
 
@@ -33,24 +33,35 @@ void SparseFuzzyTube::print(vector<unsigned int>& prefix, ostream& out) const
     }
 }
 
-const bool SparseFuzzyTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts)
+AbstractData* SparseFuzzyTube::compress()
+{
+#ifdef SORTED_SPARSE_TUBES
+  vector<pair<unsigned int, unsigned int>> noisyHyperplanes(tube.begin(), tube.end());
+  sort(noisyHyperplanes.begin(), noisyHyperplanes.end());
+  return new SortedFuzzyTube(noisyHyperplanes);
+#else
+  return this;
+#endif
+}
+
+const bool SparseFuzzyTube::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
 {
   const unsigned int element = oldIds2NewIdsIt->at(tuple[*attributeIdIt]);
   (*attributeIt)->substractPotentialNoise(element, membership);
-  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+  for (Intersections::iterator intersectionIt : intersectionIts)
     {
-      (*intersectionIt)[element] -= membership;
+      Trail::decrease((*intersectionIt)[element], membership);
     }
   tube[element] = Attribute::noisePerUnit - membership;
   return tube.bucket_count() * sizeof(unsigned int) + 2 * tube.size() * sizeof(unsigned int*) > (*attributeIt)->sizeOfPresentAndPotential() * densityThreshold; // In the worst case (all values in th same bucket), the unordered_map<unsigned int, unsigned int> takes more space than a vector<unsigned int> * densityThreshold
 }
 
-const unsigned int SparseFuzzyTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, const unsigned int dimensionId)
+const unsigned int SparseFuzzyTube::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId)
 {
   // Necessarily symmetric
-  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+  for (Intersections::iterator intersectionIt : intersectionIts)
     {
-      (*intersectionIt)[hyperplaneId] -= Attribute::noisePerUnit;
+      Trail::decrease((*intersectionIt)[hyperplaneId], Attribute::noisePerUnit);
     }
   (*attributeIt)->substractPotentialNoise(hyperplaneId, Attribute::noisePerUnit);
   tube[hyperplaneId] = 0;
@@ -82,18 +93,18 @@ const unsigned int SparseFuzzyTube::noiseOnValues(const vector<Attribute*>::cons
   return oldNoise;
 }
 
-const unsigned int SparseFuzzyTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int SparseFuzzyTube::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the present attribute
   return noiseOnValue((*attributeIt)->getChosenValue().getDataId());
 }
 
-const unsigned int SparseFuzzyTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int SparseFuzzyTube::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   // *this necessarily relates to the present attribute
   const Value& presentValue = (*attributeIt)->getChosenValue();
   const unsigned int noise = noiseOnValue(presentValue.getDataId());
-  (*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()] += noise;
+  Trail::increase((*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()], noise);
   return noise;
 }
 
@@ -110,20 +121,20 @@ const unsigned int SparseFuzzyTube::presentFixPresentValuesAfterPresentValueMet(
   return newNoise;
 }
 
-const unsigned int SparseFuzzyTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int SparseFuzzyTube::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
       const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
-      (*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()] += newNoiseInHyperplane;
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], newNoiseInHyperplane);
       newNoise += newNoiseInHyperplane;
     }
   return newNoise;
 }
 
-void SparseFuzzyTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void SparseFuzzyTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
@@ -131,14 +142,14 @@ void SparseFuzzyTube::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attr
       const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-void SparseFuzzyTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void SparseFuzzyTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   // The first potential value actually is the value set present and there is no noise to be found at the insection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
@@ -147,26 +158,26 @@ void SparseFuzzyTube::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribut
       const unsigned int newNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-const unsigned int SparseFuzzyTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int SparseFuzzyTube::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the absent attribute
   return noiseOnValues(absentAttributeIt, absentValueDataIds);
 }
 
-const unsigned int SparseFuzzyTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int SparseFuzzyTube::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
   // *this necessarily relates to the absent attribute
   return noiseOnValues(absentAttributeIt, absentValueDataIds);
 }
 
-const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
@@ -175,16 +186,16 @@ const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsent
       const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -194,9 +205,9 @@ const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSym
       const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
@@ -206,29 +217,29 @@ const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSym
       const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
       const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const Intersections::iterator absentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -236,20 +247,20 @@ const unsigned int SparseFuzzyTube::absentFixPresentOrPotentialValuesInSecondSym
   for (; valueIt != end; ++valueIt)
     {
       const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   end = currentAttribute.irrelevantEnd();
   while (++valueIt != end)
     {
       const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
   
-void SparseFuzzyTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void SparseFuzzyTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
@@ -257,9 +268,9 @@ void SparseFuzzyTube::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& curre
       const unsigned int oldNoiseInHyperplane = noiseOnValue((*valueIt)->getDataId());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
     }
 }
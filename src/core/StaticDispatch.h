@@ -0,0 +1,222 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef STATIC_DISPATCH_H_
+#define STATIC_DISPATCH_H_
+
+#include "Trie.h"
+
+/* dispatch calls operation on hyperplane statically cast to its final class: every class deriving from AbstractData being final, the compiler resolves (and can inline) the called method instead of going through the virtual table */
+template<typename Operation> inline const typename Operation::result_type dispatch(const AbstractData& hyperplane, const Operation& operation)
+{
+  switch (hyperplane.getDataType())
+    {
+    case AbstractData::trieData:
+      return operation(static_cast<const Trie&>(hyperplane));
+    case AbstractData::noNoiseTubeData:
+      return operation(static_cast<const NoNoiseTube&>(hyperplane));
+    case AbstractData::sparseCrispTubeData:
+      return operation(static_cast<const SparseCrispTube&>(hyperplane));
+    case AbstractData::denseCrispTubeData:
+      return operation(static_cast<const DenseCrispTube&>(hyperplane));
+    case AbstractData::compressedCrispTubeData:
+      return operation(static_cast<const CompressedCrispTube&>(hyperplane));
+    case AbstractData::sparseFuzzyTubeData:
+      return operation(static_cast<const SparseFuzzyTube&>(hyperplane));
+    case AbstractData::sortedFuzzyTubeData:
+      return operation(static_cast<const SortedFuzzyTube&>(hyperplane));
+    case AbstractData::denseFuzzyTube8Data:
+      return operation(static_cast<const DenseFuzzyTube<unsigned char>&>(hyperplane));
+    case AbstractData::denseFuzzyTube16Data:
+      return operation(static_cast<const DenseFuzzyTube<unsigned short>&>(hyperplane));
+    default:
+      return operation(static_cast<const DenseFuzzyTube<unsigned int>&>(hyperplane));
+    }
+}
+
+// One operation per method of AbstractData called in the recursions of Trie
+
+struct setPresentOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator presentAttributeIt;
+  const vector<Attribute*>::iterator attributeIt;
+  vector<Intersections::iterator>& intersectionIts;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setPresent(presentAttributeIt, attributeIt, intersectionIts);
+  }
+};
+
+struct setPresentAfterPresentValueMetOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator attributeIt;
+  vector<Intersections::iterator>& intersectionIts;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setPresentAfterPresentValueMet(attributeIt, intersectionIts);
+  }
+};
+
+struct setSymmetricPresentAfterPresentValueMetOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator attributeIt;
+  vector<Intersections::iterator>& intersectionIts;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setSymmetricPresentAfterPresentValueMet(attributeIt, intersectionIts);
+  }
+};
+
+struct setPresentAfterPotentialOrAbsentUsedOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator presentAttributeIt;
+  const vector<Attribute*>::iterator attributeIt;
+  const Intersections::iterator potentialOrAbsentValueIntersectionIt;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setPresentAfterPotentialOrAbsentUsed(presentAttributeIt, attributeIt, potentialOrAbsentValueIntersectionIt);
+  }
+};
+
+struct setPresentAfterPresentValueMetAndPotentialOrAbsentUsedOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator attributeIt;
+  const Intersections::iterator potentialOrAbsentValueIntersectionIt;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(attributeIt, potentialOrAbsentValueIntersectionIt);
+  }
+};
+
+struct setAbsentOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator absentAttributeIt;
+  const vector<unsigned int>& absentValueDataIds;
+  const vector<Attribute*>::iterator attributeIt;
+  vector<Intersections::iterator>& intersectionIts;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setAbsent(absentAttributeIt, absentValueDataIds, attributeIt, intersectionIts);
+  }
+};
+
+struct setAbsentAfterAbsentValuesMetOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator attributeIt;
+  vector<Intersections::iterator>& intersectionIts;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setAbsentAfterAbsentValuesMet(attributeIt, intersectionIts);
+  }
+};
+
+struct setSymmetricAbsentAfterAbsentValueMetOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator attributeIt;
+  vector<Intersections::iterator>& intersectionIts;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setSymmetricAbsentAfterAbsentValueMet(attributeIt, intersectionIts);
+  }
+};
+
+struct setAbsentAfterAbsentUsedOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator absentAttributeIt;
+  const vector<unsigned int>& absentValueDataIds;
+  const vector<Attribute*>::iterator attributeIt;
+  const Intersections::iterator absentValueIntersectionIt;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setAbsentAfterAbsentUsed(absentAttributeIt, absentValueDataIds, attributeIt, absentValueIntersectionIt);
+  }
+};
+
+struct setAbsentAfterAbsentValuesMetAndAbsentUsedOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator attributeIt;
+  const Intersections::iterator absentValueIntersectionIt;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setAbsentAfterAbsentValuesMetAndAbsentUsed(attributeIt, absentValueIntersectionIt);
+  }
+};
+
+struct setSymmetricAbsentAfterAbsentValueMetAndAbsentUsedOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<Attribute*>::iterator attributeIt;
+  const Intersections::iterator absentValueIntersectionIt;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.setSymmetricAbsentAfterAbsentValueMetAndAbsentUsed(attributeIt, absentValueIntersectionIt);
+  }
+};
+
+struct countNoiseOperation
+{
+  typedef unsigned int result_type;
+
+  const vector<vector<unsigned int>>::const_iterator dimensionIt;
+
+  template<typename T> const unsigned int operator()(const T& data) const
+  {
+    return data.countNoise(dimensionIt);
+  }
+};
+
+struct decreaseMembershipDownToThresholdOperation
+{
+  typedef bool result_type;
+
+  const double membershipThreshold;
+  const vector<vector<unsigned int>>::const_iterator dimensionIt;
+  const vector<vector<unsigned int>::const_iterator>::iterator tupleIt;
+  double& membershipSum;
+
+  template<typename T> const bool operator()(const T& data) const
+  {
+    return data.decreaseMembershipDownToThreshold(membershipThreshold, dimensionIt, tupleIt, membershipSum);
+  }
+};
+
+#endif /*STATIC_DISPATCH_H_*/
@@ -14,17 +14,17 @@ SymmetricAttribute::SymmetricAttribute(): Attribute(), symmetricAttribute(nullpt
 {
 }
 
-SymmetricAttribute::SymmetricAttribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels): Attribute(nbOfValuesPerAttribute, epsilon, labels), symmetricAttribute(nullptr)
+SymmetricAttribute::SymmetricAttribute(const vector<unsigned int>& nbOfValuesPerAttribute, const double epsilon, const vector<string>& labels, Arena& arena): Attribute(nbOfValuesPerAttribute, epsilon, labels, arena), symmetricAttribute(nullptr)
 {
 }
 
-SymmetricAttribute::SymmetricAttribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd): Attribute(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt, sizeOfAttributeEnd), symmetricAttribute(nullptr)
+SymmetricAttribute::SymmetricAttribute(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena): Attribute(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt, sizeOfAttributeEnd, arena), symmetricAttribute(nullptr)
 {
 }
 
-SymmetricAttribute* SymmetricAttribute::clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd) const
+SymmetricAttribute* SymmetricAttribute::clone(const vector<Attribute*>::const_iterator parentAttributeIt, const vector<Attribute*>::const_iterator parentAttributeEnd, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena) const
 {
-  return new SymmetricAttribute(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt, sizeOfAttributeEnd);
+  return new (arena.allocate(sizeof(SymmetricAttribute), alignof(SymmetricAttribute))) SymmetricAttribute(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt, sizeOfAttributeEnd, arena);
 }
 
 void SymmetricAttribute::setSymmetricAttribute(SymmetricAttribute* symmetricAttributeParam)
@@ -0,0 +1,39 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "Trail.h"
+
+#ifdef TRAIL
+thread_local vector<pair<unsigned int*, unsigned int>> Trail::oldCounters;
+thread_local vector<unsigned int> Trail::marks;
+
+const bool Trail::isRecording()
+{
+  return !marks.empty();
+}
+
+void Trail::mark()
+{
+  marks.push_back(oldCounters.size());
+}
+
+void Trail::rollback()
+{
+  // Restore in reverse order so that a counter modified several times gets its value at the mark
+  const vector<pair<unsigned int*, unsigned int>>::iterator markIt = oldCounters.begin() + marks.back();
+  for (vector<pair<unsigned int*, unsigned int>>::iterator oldCounterIt = oldCounters.end(); oldCounterIt != markIt; )
+    {
+      --oldCounterIt;
+      *oldCounterIt->first = oldCounterIt->second;
+    }
+  oldCounters.erase(markIt, oldCounters.end());
+  marks.pop_back();
+}
+#endif
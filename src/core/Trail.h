@@ -0,0 +1,59 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef TRAIL_H_
+#define TRAIL_H_
+
+#include "../../Parameters.h"
+
+#include <vector>
+
+using namespace std;
+
+class Trail
+{
+ public:
+  static void increase(unsigned int& counter, const unsigned int delta);
+  static void decrease(unsigned int& counter, const unsigned int delta);
+
+#ifdef TRAIL
+  static const bool isRecording();
+  static void mark();
+  static void rollback(); /* restores the counters modified since the last mark and removes that mark */
+
+ protected:
+  static thread_local vector<pair<unsigned int*, unsigned int>> oldCounters;
+  static thread_local vector<unsigned int> marks;
+#endif
+};
+
+inline void Trail::increase(unsigned int& counter, const unsigned int delta)
+{
+#ifdef TRAIL
+  if (!marks.empty())
+    {
+      oldCounters.emplace_back(&counter, counter);
+    }
+#endif
+  counter += delta;
+}
+
+inline void Trail::decrease(unsigned int& counter, const unsigned int delta)
+{
+#ifdef TRAIL
+  if (!marks.empty())
+    {
+      oldCounters.emplace_back(&counter, counter);
+    }
+#endif
+  counter -= delta;
+}
+
+#endif /*TRAIL_H_*/
@@ -10,6 +10,8 @@
 
 #include "Tree.h"
 
+#include <numeric>
+
 const bool smallerDimension(const Dimension* dimension, const Dimension* otherDimension)
 {
   return *dimension < *otherDimension;
@@ -27,10 +29,10 @@ double Tree::preProcessingDuration;
 double Tree::minSizeElementPruningDuration = 0;
 #endif
 #ifdef NB_OF_LEFT_NODES
-unsigned int Tree::nbOfLeftNodes = 0;
+atomic<unsigned int> Tree::nbOfLeftNodes(0);
 #endif
 #ifdef NB_OF_CLOSED_N_SETS
-unsigned int Tree::nbOfClosedNSets = 0;
+atomic<unsigned int> Tree::nbOfClosedNSets(0);
 #endif
 
 vector<unsigned int> Tree::external2InternalAttributeOrder;
@@ -42,15 +44,19 @@ vector<unsigned int> Tree::minSizes;
 double Tree::minArea;
 
 bool Tree::isAgglomeration;
-ofstream Tree::outputFile;
+WorkStealingPool* Tree::threadPool = nullptr;
+unsigned int Tree::minNbOfPotentialElementsInTask;
+mutex Tree::outputLock;
+BufferedOutputFile Tree::outputFile;
 string Tree::outputDimensionSeparator;
 string Tree::patternSizeSeparator;
 string Tree::sizeSeparator;
 string Tree::sizeAreaSeparator;
 bool Tree::isSizePrinted;
 bool Tree::isAreaPrinted;
+bool Tree::isOutputBinary;
 
-Tree::Tree(const char* dataFileName, const float densityThreshold, const double shiftMultiplier, const vector<double>& epsilonVectorParam, const vector<unsigned int>& cliqueDimensionsParam, const vector<double>& tauVectorParam, const vector<unsigned int>& minSizesParam, const unsigned int minAreaParam, const bool isReductionOnly, const bool isAgglomerationParam, const vector<unsigned int>& unclosedDimensions, const char* inputElementSeparator, const char* inputDimensionSeparator, const char* outputFileName, const char* outputDimensionSeparatorParam, const char* patternSizeSeparatorParam, const char* sizeSeparatorParam, const char* sizeAreaSeparatorParam, const bool isSizePrintedParam, const bool isAreaPrintedParam) : attributes(), mereConstraints(), isEnumeratedElementPotentiallyPreventingClosedness(false)
+Tree::Tree(const char* dataFileName, const float densityThreshold, const double shiftMultiplier, const vector<double>& epsilonVectorParam, const vector<unsigned int>& cliqueDimensionsParam, const vector<double>& tauVectorParam, const vector<unsigned int>& minSizesParam, const unsigned int minAreaParam, const bool isReductionOnly, const char* savedReducedDataFileName, const char* loadedReducedDataFileName, const bool isAgglomerationParam, const vector<unsigned int>& unclosedDimensions, const char* inputElementSeparator, const char* inputDimensionSeparator, const char* outputFileName, const char* outputDimensionSeparatorParam, const char* patternSizeSeparatorParam, const char* sizeSeparatorParam, const char* sizeAreaSeparatorParam, const bool isSizePrintedParam, const bool isAreaPrintedParam, const bool isOutputBinaryParam) : arena(), attributes(), mereConstraints(), isEnumeratedElementPotentiallyPreventingClosedness(false)
 {
 #ifdef TIME
   overallBeginning = steady_clock::now();
@@ -74,9 +80,39 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	}
       ++dimensionId;
     }
+  isAgglomeration = isAgglomerationParam;
+  minArea = minAreaParam;
+  outputDimensionSeparator = outputDimensionSeparatorParam;
+  patternSizeSeparator = patternSizeSeparatorParam;
+  sizeSeparator = sizeSeparatorParam;
+  sizeAreaSeparator = sizeAreaSeparatorParam;
+  isSizePrinted = isSizePrintedParam;
+  isAreaPrinted = isAreaPrintedParam;
+  isOutputBinary = isOutputBinaryParam;
+  ReducedDataFile reducedData(epsilonVectorParam, cliqueDimensionsParam, tauVectorParam, minSizesParam, minAreaParam, isAgglomerationParam);
 #ifdef DETAILED_TIME
   startingPoint = steady_clock::now();
 #endif
+  if (*loadedReducedDataFileName != '\0')
+    {
+      reducedData.read(loadedReducedDataFileName);
+#ifdef DETAILED_TIME
+      parsingDuration = duration_cast<duration<double>>(steady_clock::now() - startingPoint).count();
+      preProcessingDuration = 0;
+#endif
+#ifdef OUTPUT
+      outputFile.open(outputFileName);
+      if (isOutputBinary)
+	{
+	  BinaryPatternFile::writeHeader(outputFile.stream());
+	}
+#endif
+      if (!reducedData.internal2ExternalAttributeOrder.empty())
+	{
+	  initFromReducedData(reducedData, densityThreshold, shiftMultiplier, tauVectorParam, cliqueDimensionsParam, unclosedDimensions);
+	}
+      return;
+    }
   NoisyTupleFileReader noisyTupleFileReader(dataFileName, cliqueDimensionsParam, numDimensionIds, inputDimensionSeparator, inputElementSeparator);
   pair<vector<unsigned int>, double> noisyTuple = noisyTupleFileReader.next();
   const unsigned int n = noisyTuple.first.size();
@@ -92,7 +128,6 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
     {
       throw UsageException(("epsilon option should provide at most " + lexical_cast<string>(n) + " coefficients!").c_str());
     }
-  isAgglomeration = isAgglomerationParam;
   if (!isAgglomeration)
     {
       double minMembership = 1;
@@ -112,7 +147,6 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
     }
   // Initialize minSizeVector and find out whether the pre-process is wanted/useful
   bool isToBePreProcessed = true;
-  minArea = minAreaParam;
   vector<unsigned int> minSizeVector = minSizesParam;
   if (minArea == 0)
     {
@@ -139,6 +173,7 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
     }
   // Parse
   // TODO: one copy of the data if isToBePreProcessed is false (and add an option to disable the pre-process)
+  noisyTupleFileReader.parseRemainingLinesInParallel();
   vector<vector<NoisyTuples*>> hyperplanes(n);
   bool isCrisp = true;
   for (; noisyTuple.second != 0; noisyTuple = noisyTupleFileReader.next())
@@ -146,10 +181,9 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
       isCrisp = isCrisp && noisyTuple.second == 1;
       dimensionId = 0;
       vector<unsigned int>::const_iterator cliqueDimensionIt = cliqueDimensionsParam.begin();
-      vector<unsigned int> projectedTuple(noisyTuple.first.begin() + 1, noisyTuple.first.end());
-      vector<unsigned int>::iterator projectedTupleIt = projectedTuple.begin();
+      const unsigned int tupleId = NoisyTuples::newTuple(noisyTuple.first, noisyTuple.second);
       vector<unsigned int>::const_iterator elementIt = noisyTuple.first.begin();
-      for (vector<vector<NoisyTuples*>>::iterator hyperplanesInDimensionIt = hyperplanes.begin(); ; ++hyperplanesInDimensionIt)
+      for (vector<vector<NoisyTuples*>>::iterator hyperplanesInDimensionIt = hyperplanes.begin(); hyperplanesInDimensionIt != hyperplanes.end(); ++hyperplanesInDimensionIt)
 	{
 	  if (cliqueDimensionIt != cliqueDimensionEnd && *cliqueDimensionIt == dimensionId++)
 	    {
@@ -169,14 +203,10 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 		  hyperplanesInDimensionIt->push_back(new NoisyTuples());
 		}
 	    }
-	  (*hyperplanesInDimensionIt)[*elementIt]->insert(projectedTuple, noisyTuple.second);
-	  if (projectedTupleIt == projectedTuple.end())
-	    {
-	      break;
-	    }
-	  *projectedTupleIt++ = *elementIt++;
+	  (*hyperplanesInDimensionIt)[*elementIt++]->insert(tupleId);
 	}
     }
+  NoisyTuples::eraseDuplicates(hyperplanes);
   vector<unsigned int> cardinalities = noisyTupleFileReader.getCardinalities();
   vector<vector<NoisyTuples*>>::iterator hyperplanesInDimensionIt = hyperplanes.begin();
   for (const unsigned int cardinality : cardinalities)
@@ -320,14 +350,18 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 #endif
 #ifdef OUTPUT
   outputFile.open(outputFileName);
-  if (!outputFile)
+  if (isOutputBinary)
     {
-      throw NoFileException(outputFileName);
+      BinaryPatternFile::writeHeader(outputFile.stream());
     }
 #endif
   if (dimensions.front()->getCardinality() == 0)
     {
       // The pre-process erased all tuples
+      if (*savedReducedDataFileName != '\0')
+	{
+	  reducedData.write(savedReducedDataFileName);
+	}
       for (Dimension* dimension : dimensions)
 	{
 	  delete dimension;
@@ -339,6 +373,7 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	      delete hyperplane;
 	    }
 	}
+      NoisyTuples::deleteTuples();
       return;
     }
   if (isReductionOnly)
@@ -352,84 +387,55 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	    }
 	}
       // Output the reduced data
-      unsigned int firstDimensionHyperplaneId = 0;
+#ifdef OUTPUT
+      ostream& out = outputFile.stream();
+#endif
       bool isFirst = true;
+      vector<unsigned int> tuple;
       vector<NoisyTuples*>& hyperplanesInFirstDimension = hyperplanes.front();
       for (NoisyTuples* hyperplane : hyperplanesInFirstDimension)
 	{
 #ifdef OUTPUT
 	  if (!hyperplane->empty())
 	    {
-	      if (isFirst)
+	      for (const unsigned int tupleId : *hyperplane)
 		{
-		  isFirst = false;
-		}
-	      else
-		{
-		  outputFile << endl;
+		  if (isFirst)
+		    {
+		      isFirst = false;
+		    }
+		  else
+		    {
+		      out << endl;
+		    }
+		  NoisyTuples::getTuple(tupleId, tuple);
+		  noisyTupleFileReader.printTuple(out, tuple, NoisyTuples::getMembership(tupleId), outputDimensionSeparatorParam);
 		}
-	      noisyTupleFileReader.printTuplesInFirstDimensionHyperplane(outputFile, firstDimensionHyperplaneId, hyperplane->begin(), hyperplane->end(), outputDimensionSeparatorParam);
 	    }
-	  ++firstDimensionHyperplaneId;
 #endif
 	  delete hyperplane;
 	}
+      NoisyTuples::deleteTuples();
       for (Dimension* dimension : dimensions)
 	{
 	  delete dimension;
 	}
 #ifdef OUTPUT
-      outputFile << endl;
+      out << endl;
 #endif
       return;
     }
-  // Init some static variables
-  outputDimensionSeparator = outputDimensionSeparatorParam;
-  patternSizeSeparator = patternSizeSeparatorParam;
-  sizeSeparator = sizeSeparatorParam;
-  sizeAreaSeparator = sizeAreaSeparatorParam;
-  isSizePrinted = isSizePrintedParam;
-  isAreaPrinted = isAreaPrintedParam;
   // Order the dimensions by increasing cardinality
   sort(dimensions.begin(), dimensions.end(), smallerDimension);
-  external2InternalAttributeOrder.resize(n);
-  unsigned int attributeId = 0;
   vector<unsigned int> internal2ExternalAttributeOrder;
   internal2ExternalAttributeOrder.reserve(n);
   for (const Dimension* dimension : dimensions)
     {
-      dimensionId = dimension->getId();
-      internal2ExternalAttributeOrder.push_back(dimensionId);
-      external2InternalAttributeOrder[dimensionId] = attributeId++;
+      internal2ExternalAttributeOrder.push_back(dimension->getId());
     }
-#if defined DEBUG || defined ASSERT
-  Attribute::setInternal2ExternalAttributeOrder(internal2ExternalAttributeOrder);
-#endif
-#ifdef DEBUG
-  Measure::setInternal2ExternalAttributeOrder(internal2ExternalAttributeOrder);
-#endif
-  // Define symmetric attributes ids accordingly
-  firstSymmetricAttributeId = numeric_limits<unsigned int>::max();
-  lastSymmetricAttributeId = 0;
-  for (const unsigned int cliqueDimension : cliqueDimensionsParam)
-    {
-      const unsigned int symmetricAttributeId = external2InternalAttributeOrder[cliqueDimension];
-      if (symmetricAttributeId < firstSymmetricAttributeId)
-	{
-	  firstSymmetricAttributeId = symmetricAttributeId;
-	}
-      if (symmetricAttributeId > lastSymmetricAttributeId)
-	{
-	  lastSymmetricAttributeId = symmetricAttributeId;
-	}
-    }
-#ifdef MIN_SIZE_ELEMENT_PRUNING
-  // Initialize parameters to compute presentAndPotentialIrrelevancyThresholds given the sky-patterns
-  IndistinctSkyPatterns::setParametersToComputePresentAndPotentialIrrelevancyThresholds(firstSymmetricAttributeId, lastSymmetricAttributeId);
-#endif
-  // Initialize cardinalities and oldIds2NewIds according to the new attribute order, delete the elements in dimensions and the hyperplanes not in the first internal dimension, compute the noise per unit (noise is stored in unsigned integers whose maximal value, the number of tuples in the hyperplane of the smallest dimension, is assigned to numeric_limits<unsigned int>::max())
+  setAttributeOrder(internal2ExternalAttributeOrder, cliqueDimensionsParam);
+  // Initialize cardinalities and oldIds2NewIds according to the new attribute order, delete the elements in dimensions and the hyperplanes not in the first internal dimension
   vector<unsigned int>::iterator cardinalityIt = cardinalities.begin();
-  unsigned int largestNoise = 1;
   vector<vector<unsigned int>> oldIds2NewIds;
   oldIds2NewIds.reserve(n);
   vector<unsigned int>::const_iterator externalAttributeIdIt = internal2ExternalAttributeOrder.begin();
@@ -462,19 +468,11 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	    {
 	      delete hyperplane;
 	    }
-	  largestNoise *= cardinality;
 	}
       *cardinalityIt++ = cardinality;
       ++externalAttributeIdIt;
     }
-  Attribute::noisePerUnit = numeric_limits<unsigned int>::max() / largestNoise;
-#ifdef NUMERIC_PRECISION
-#ifdef GNUPLOT
-      cout << 1. / Attribute::noisePerUnit;
-#else
-      cout << "Numeric precision: " << 1. / Attribute::noisePerUnit << endl;
-#endif
-#endif
+  const unsigned int largestNoise = setNoisePerUnit(cardinalities, isCrisp);
   // Initialize attributes, minSizes and labels2Ids
   labels2Ids.reserve(n);
   minSizes.reserve(n);
@@ -490,8 +488,12 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	  const vector<string> symmetricLabels = noisyTupleFileReader.setNewIdsAndGetSymmetricLabels(*oldIds2NewIdsIt, *cardinalityIt);
 	  cardinalityIt += cliqueDimensionsParam.size();
 	  oldIds2NewIdsIt += cliqueDimensionsParam.size();
-	  SymmetricAttribute* firstSymmetricAttribute = new SymmetricAttribute(cardinalities, epsilonVector[*externalAttributeIdIt++], symmetricLabels);
-	  SymmetricAttribute* secondSymmetricAttribute = new SymmetricAttribute(cardinalities, epsilonVector[*externalAttributeIdIt++], symmetricLabels);
+	  if (*savedReducedDataFileName != '\0')
+	    {
+	      reducedData.labels.insert(reducedData.labels.end(), cliqueDimensionsParam.size(), symmetricLabels);
+	    }
+	  SymmetricAttribute* firstSymmetricAttribute = arena.create<SymmetricAttribute>(cardinalities, epsilonVector[*externalAttributeIdIt++], symmetricLabels, arena);
+	  SymmetricAttribute* secondSymmetricAttribute = arena.create<SymmetricAttribute>(cardinalities, epsilonVector[*externalAttributeIdIt++], symmetricLabels, arena);
 	  firstSymmetricAttribute->setSymmetricAttribute(secondSymmetricAttribute);
 	  secondSymmetricAttribute->setSymmetricAttribute(firstSymmetricAttribute);
 	  attributes.push_back(firstSymmetricAttribute);
@@ -501,13 +503,18 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	}
       else
 	{
+	  const vector<string> labels = noisyTupleFileReader.setNewIdsAndGetLabels(*externalAttributeIdIt, *oldIds2NewIdsIt++, *cardinalityIt++);
+	  if (*savedReducedDataFileName != '\0')
+	    {
+	      reducedData.labels.push_back(labels);
+	    }
 	  if (*externalAttributeIdIt < tauVectorParam.size() && tauVectorParam[*externalAttributeIdIt] != 0)
 	    {
-	      attributes.push_back(new MetricAttribute(cardinalities, epsilonVector[*externalAttributeIdIt], noisyTupleFileReader.setNewIdsAndGetLabels(*externalAttributeIdIt, *oldIds2NewIdsIt++, *cardinalityIt++), tauVectorParam[*externalAttributeIdIt]));
+	      attributes.push_back(arena.create<MetricAttribute>(cardinalities, epsilonVector[*externalAttributeIdIt], labels, tauVectorParam[*externalAttributeIdIt], arena));
 	    }
 	  else
 	    {
-	      attributes.push_back(new Attribute(cardinalities, epsilonVector[*externalAttributeIdIt], noisyTupleFileReader.setNewIdsAndGetLabels(*externalAttributeIdIt, *oldIds2NewIdsIt++, *cardinalityIt++)));
+	      attributes.push_back(arena.create<Attribute>(cardinalities, epsilonVector[*externalAttributeIdIt], labels, arena));
 	    }
 	  minSizes.push_back(minSizeVector[*externalAttributeIdIt]);
 	  labels2Ids.push_back(noisyTupleFileReader.captureLabels2Ids(*externalAttributeIdIt));
@@ -515,25 +522,185 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	}
     }
   // Compute order in which to access the tuples in hyperplanes of the first attribute; delete hyperplanes not in the first attribute
-  vector<unsigned int> attributeOrderForTuplesInFirstAtributeHyperplanes;
-  attributeOrderForTuplesInFirstAtributeHyperplanes.reserve(n - 1);
   const unsigned int firstExternalAttributeId = internal2ExternalAttributeOrder.front();
-  const vector<unsigned int>::const_iterator externalAttributeIdEnd = internal2ExternalAttributeOrder.end();
-  for (externalAttributeIdIt = internal2ExternalAttributeOrder.begin(); ++externalAttributeIdIt != externalAttributeIdEnd; )
+  const vector<unsigned int> attributeOrderForTuplesInFirstAtributeHyperplanes(internal2ExternalAttributeOrder.begin() + 1, internal2ExternalAttributeOrder.end());
+  // Initialize data
+  initData(isCrisp, densityThreshold, cardinalities);
+  // Insert tuples but self loops
+  unsigned int hyperplaneOldId = 0;
+  vector<unsigned int> tuple;
+  vector<NoisyTuples*>& hyperplanesInFirstAttribute = hyperplanes[firstExternalAttributeId];
+  for (NoisyTuples* hyperplane : hyperplanesInFirstAttribute)
     {
-      if (*externalAttributeIdIt < firstExternalAttributeId)
+      if (!hyperplane->empty())
 	{
-	  attributeOrderForTuplesInFirstAtributeHyperplanes.push_back(*externalAttributeIdIt);
+	  const unsigned int hyperplaneId = oldIds2NewIds.front().at(hyperplaneOldId);
+	  for (const unsigned int tupleId : *hyperplane)
+	    {
+	      NoisyTuples::getTuple(tupleId, tuple);
+	      data->setNoisyTuple(hyperplaneId, tuple, NoisyTuples::getMembership(tupleId), attributeOrderForTuplesInFirstAtributeHyperplanes, oldIds2NewIds.begin() + 1, attributes);
+	      if (*savedReducedDataFileName != '\0')
+		{
+		  reducedData.addTuple(hyperplaneId, tuple, NoisyTuples::getMembership(tupleId), attributeOrderForTuplesInFirstAtributeHyperplanes, oldIds2NewIds);
+		}
+	    }
+	}
+      delete hyperplane;
+      ++hyperplaneOldId;
+    }
+  NoisyTuples::deleteTuples();
+#if defined COMPRESSED_TUBES || defined SORTED_SPARSE_TUBES
+  data->compress();
+#endif
+  if (*savedReducedDataFileName != '\0')
+    {
+      reducedData.internal2ExternalAttributeOrder = internal2ExternalAttributeOrder;
+      reducedData.cardinalities = cardinalities;
+      reducedData.epsilons.reserve(n);
+      for (const unsigned int externalAttributeId : internal2ExternalAttributeOrder)
+	{
+	  reducedData.epsilons.push_back(epsilonVector[externalAttributeId]);
+	}
+      reducedData.minSizes = minSizes;
+      reducedData.labels2Ids = labels2Ids;
+      reducedData.isCrisp = isCrisp;
+      reducedData.write(savedReducedDataFileName);
+    }
+  setIsClosedVector(shiftMultiplier, largestNoise, unclosedDimensions, cliqueDimensionsParam.size());
+#ifdef DETAILED_TIME
+  startingPoint = steady_clock::now();
+#endif
+}
+
+void Tree::initFromReducedData(const ReducedDataFile& reducedData, const float densityThreshold, const double shiftMultiplier, const vector<double>& tauVector, const vector<unsigned int>& cliqueDimensions, const vector<unsigned int>& unclosedDimensions)
+{
+  const vector<unsigned int>& internal2ExternalAttributeOrder = reducedData.internal2ExternalAttributeOrder;
+  const vector<unsigned int>& cardinalities = reducedData.cardinalities;
+  const unsigned int n = internal2ExternalAttributeOrder.size();
+  setAttributeOrder(internal2ExternalAttributeOrder, cliqueDimensions);
+  const unsigned int largestNoise = setNoisePerUnit(cardinalities, reducedData.isCrisp);
+  // Initialize attributes, minSizes and labels2Ids
+  minSizes = reducedData.minSizes;
+  labels2Ids = reducedData.labels2Ids;
+  vector<double>::const_iterator epsilonIt = reducedData.epsilons.begin();
+  vector<vector<string>>::const_iterator labelsIt = reducedData.labels.begin();
+  vector<unsigned int>::const_iterator externalAttributeIdIt = internal2ExternalAttributeOrder.begin();
+  attributes.reserve(n);
+  for (unsigned int attributeId = 0; attributeId != n; ++attributeId)
+    {
+      if (attributeId == firstSymmetricAttributeId)
+	{
+	  SymmetricAttribute* firstSymmetricAttribute = arena.create<SymmetricAttribute>(cardinalities, *epsilonIt++, *labelsIt++, arena);
+	  SymmetricAttribute* secondSymmetricAttribute = arena.create<SymmetricAttribute>(cardinalities, *epsilonIt++, *labelsIt++, arena);
+	  firstSymmetricAttribute->setSymmetricAttribute(secondSymmetricAttribute);
+	  secondSymmetricAttribute->setSymmetricAttribute(firstSymmetricAttribute);
+	  attributes.push_back(firstSymmetricAttribute);
+	  attributes.push_back(secondSymmetricAttribute);
+	  externalAttributeIdIt += 2;
+	  ++attributeId;
 	}
       else
 	{
-	  if (*externalAttributeIdIt > firstExternalAttributeId)
+	  if (*externalAttributeIdIt < tauVector.size() && tauVector[*externalAttributeIdIt] != 0)
+	    {
+	      attributes.push_back(arena.create<MetricAttribute>(cardinalities, *epsilonIt++, *labelsIt++, tauVector[*externalAttributeIdIt], arena));
+	    }
+	  else
 	    {
-	      attributeOrderForTuplesInFirstAtributeHyperplanes.push_back(*externalAttributeIdIt - 1);
+	      attributes.push_back(arena.create<Attribute>(cardinalities, *epsilonIt++, *labelsIt++, arena));
 	    }
+	  ++externalAttributeIdIt;
 	}
     }
   // Initialize data
+  initData(reducedData.isCrisp, densityThreshold, cardinalities);
+  // Insert tuples but self loops: their ids already are the new ones and they are in the internal attribute order
+  vector<unsigned int> attributeOrder(n - 1);
+  iota(attributeOrder.begin(), attributeOrder.end(), 0);
+  vector<vector<unsigned int>> identities;
+  identities.reserve(n - 1);
+  const vector<unsigned int>::const_iterator cardinalityEnd = cardinalities.end();
+  for (vector<unsigned int>::const_iterator cardinalityIt = cardinalities.begin(); ++cardinalityIt != cardinalityEnd; )
+    {
+      identities.emplace_back(*cardinalityIt);
+      iota(identities.back().begin(), identities.back().end(), 0);
+    }
+  vector<double>::const_iterator membershipIt = reducedData.memberships.begin();
+  const vector<unsigned int>::const_iterator tupleEnd = reducedData.tuples.end();
+  for (vector<unsigned int>::const_iterator tupleIt = reducedData.tuples.begin(); tupleIt != tupleEnd; tupleIt += n)
+    {
+      data->setNoisyTuple(*tupleIt, vector<unsigned int>(tupleIt + 1, tupleIt + n), *membershipIt++, attributeOrder, identities.begin(), attributes);
+    }
+#if defined COMPRESSED_TUBES || defined SORTED_SPARSE_TUBES
+  data->compress();
+#endif
+  setIsClosedVector(shiftMultiplier, largestNoise, unclosedDimensions, cliqueDimensions.size());
+#ifdef DETAILED_TIME
+  startingPoint = steady_clock::now();
+#endif
+}
+
+void Tree::setAttributeOrder(const vector<unsigned int>& internal2ExternalAttributeOrder, const vector<unsigned int>& cliqueDimensions)
+{
+  external2InternalAttributeOrder.resize(internal2ExternalAttributeOrder.size());
+  unsigned int attributeId = 0;
+  for (const unsigned int externalAttributeId : internal2ExternalAttributeOrder)
+    {
+      external2InternalAttributeOrder[externalAttributeId] = attributeId++;
+    }
+#if defined DEBUG || defined ASSERT
+  Attribute::setInternal2ExternalAttributeOrder(internal2ExternalAttributeOrder);
+#endif
+#ifdef DEBUG
+  Measure::setInternal2ExternalAttributeOrder(internal2ExternalAttributeOrder);
+#endif
+  // Define symmetric attributes ids accordingly
+  firstSymmetricAttributeId = numeric_limits<unsigned int>::max();
+  lastSymmetricAttributeId = 0;
+  for (const unsigned int cliqueDimension : cliqueDimensions)
+    {
+      const unsigned int symmetricAttributeId = external2InternalAttributeOrder[cliqueDimension];
+      if (symmetricAttributeId < firstSymmetricAttributeId)
+	{
+	  firstSymmetricAttributeId = symmetricAttributeId;
+	}
+      if (symmetricAttributeId > lastSymmetricAttributeId)
+	{
+	  lastSymmetricAttributeId = symmetricAttributeId;
+	}
+    }
+#ifdef MIN_SIZE_ELEMENT_PRUNING
+  // Initialize parameters to compute presentAndPotentialIrrelevancyThresholds given the sky-patterns
+  IndistinctSkyPatterns::setParametersToComputePresentAndPotentialIrrelevancyThresholds(firstSymmetricAttributeId, lastSymmetricAttributeId);
+#endif
+}
+
+const unsigned int Tree::setNoisePerUnit(const vector<unsigned int>& cardinalities, const bool isCrisp)
+{
+  // Noise is stored in unsigned integers whose maximal value, the number of tuples in the hyperplane of the smallest dimension, is assigned to numeric_limits<unsigned int>::max()
+  unsigned int largestNoise = 1;
+  const vector<unsigned int>::const_iterator cardinalityEnd = cardinalities.end();
+  for (vector<unsigned int>::const_iterator cardinalityIt = cardinalities.begin(); ++cardinalityIt != cardinalityEnd; )
+    {
+      largestNoise *= *cardinalityIt;
+    }
+  Attribute::noisePerUnit = numeric_limits<unsigned int>::max() / largestNoise;
+  if (!isCrisp)
+    {
+      Trie::quantizeMemberships();
+    }
+#ifdef NUMERIC_PRECISION
+#ifdef GNUPLOT
+      cout << Trie::numericPrecision();
+#else
+      cout << "Numeric precision: " << Trie::numericPrecision() << endl;
+#endif
+#endif
+  return largestNoise;
+}
+
+void Tree::initData(const bool isCrisp, const float densityThreshold, const vector<unsigned int>& cardinalities)
+{
   if (isCrisp)
     {
       Trie::setCrisp();
@@ -549,20 +716,11 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
       // Insert every self loop
       data->setSelfLoops(firstSymmetricAttributeId, lastSymmetricAttributeId, attributes); // WARNING: start with the self loops (no code to insert self loops in dense structures)
     }
-  // Insert tuples but self loops
-  unsigned int hyperplaneOldId = 0;
-  vector<NoisyTuples*>& hyperplanesInFirstAttribute = hyperplanes[firstExternalAttributeId];
-  for (NoisyTuples* hyperplane : hyperplanesInFirstAttribute)
-    {
-      if (!hyperplane->empty())
-	{
-	  data->setHyperplane(hyperplaneOldId, hyperplane->begin(), hyperplane->end(), attributeOrderForTuplesInFirstAtributeHyperplanes, oldIds2NewIds, attributes);
-	}
-      delete hyperplane;
-      ++hyperplaneOldId;
-    }
-  // Initialize isClosedVector
-  vector<bool> isClosedVector(n, true);
+}
+
+void Tree::setIsClosedVector(const double shiftMultiplier, const unsigned int largestNoise, const vector<unsigned int>& unclosedDimensions, const unsigned int nbOfSymmetricAttributes) const
+{
+  vector<bool> isClosedVector(attributes.size(), true);
   if (isAgglomeration)
     {
       // Compute Attribute::noisePerUnit * (1 - shiftMultiplier * lambda_0) (see Mirkin's paper)
@@ -583,7 +741,7 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	      ++nbOfUnclosedSymmetricAttribute;
 	    }
 	}
-      if (nbOfUnclosedSymmetricAttribute != 0 && nbOfUnclosedSymmetricAttribute == cliqueDimensionsParam.size())
+      if (nbOfUnclosedSymmetricAttribute != 0 && nbOfUnclosedSymmetricAttribute == nbOfSymmetricAttributes)
 	{
 	  const vector<bool>::iterator end = isClosedVector.begin() + lastSymmetricAttributeId + 1;
 	  for (vector<bool>::iterator isClosedVectorIt = isClosedVector.begin() + firstSymmetricAttributeId; isClosedVectorIt != end; ++isClosedVectorIt)
@@ -593,13 +751,10 @@ Tree::Tree(const char* dataFileName, const float densityThreshold, const double
 	}
     }
   Attribute::setIsClosedVector(isClosedVector);
-#ifdef DETAILED_TIME
-  startingPoint = steady_clock::now();
-#endif
 }
 
 // Constructor of a left subtree
-Tree::Tree(const Tree& parent, const vector<Measure*>& mereConstraintsParam): attributes(), mereConstraints(std::move(mereConstraintsParam)), isEnumeratedElementPotentiallyPreventingClosedness(false)
+Tree::Tree(const Tree& parent, const vector<Measure*>& mereConstraintsParam): arena(), attributes(), mereConstraints(std::move(mereConstraintsParam)), isEnumeratedElementPotentiallyPreventingClosedness(false)
 {
 #ifdef NB_OF_LEFT_NODES
   ++nbOfLeftNodes;
@@ -618,7 +773,7 @@ Tree::Tree(const Tree& parent, const vector<Measure*>& mereConstraintsParam): at
   vector<unsigned int>::const_iterator sizeOfAttributeIt = sizeOfAttributes.begin();
   for (vector<Attribute*>::const_iterator parentAttributeIt = parentAttributes.begin(); parentAttributeIt != parentAttributeEnd; ++parentAttributeIt)
     {
-      attributes.push_back((*parentAttributeIt)->clone(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt++, sizeOfAttributesEnd));
+      attributes.push_back((*parentAttributeIt)->clone(parentAttributeIt, parentAttributeEnd, sizeOfAttributeIt++, sizeOfAttributesEnd, arena));
     }
   if (firstSymmetricAttributeId != numeric_limits<unsigned int>::max())
     {
@@ -631,9 +786,10 @@ Tree::Tree(const Tree& parent, const vector<Measure*>& mereConstraintsParam): at
 
 Tree::~Tree()
 {
+  // The values of the attributes are in the arena and are released with it
   for (Attribute* attribute : attributes)
     {
-      delete attribute;
+      attribute->~Attribute();
     }
   deleteMeasures(mereConstraints);
 }
@@ -977,7 +1133,7 @@ void Tree::initMeasures(const vector<unsigned int>& maxSizesParam, const int max
   stable_partition(mereConstraints.begin(), mereConstraints.end(), monotone);
 }
 
-void Tree::mine()
+void Tree::mine(const unsigned int nbOfThreads, const unsigned int minNbOfPotentialElementsInTaskParam)
 {
   if (attributes.empty())
     {
@@ -990,7 +1146,18 @@ void Tree::mine()
 #endif
       return;
     }
+  // With closed cliques, considering the enumerated elements potentially preventing closedness, as tasks do, changes the output
+  if (nbOfThreads == 1 || firstSymmetricAttributeId != numeric_limits<unsigned int>::max())
+    {
+      peel();
+      return;
+    }
+  minNbOfPotentialElementsInTask = minNbOfPotentialElementsInTaskParam;
+  threadPool = new WorkStealingPool(nbOfThreads);
   peel();
+  threadPool->wait();
+  delete threadPool;
+  threadPool = nullptr;
 }
 
 void Tree::terminate(const double maximalNbOfCandidateAgglomerates)
@@ -1005,58 +1172,21 @@ void Tree::terminate(const double maximalNbOfCandidateAgglomerates)
     {
 #ifdef DETAILED_TIME
       startingPoint = steady_clock::now();
+#endif
+#ifdef OUTPUT
+      ostream& out = outputFile.stream();
 #endif
       for (pair<list<Node*>::const_iterator, list<Node*>::const_iterator> nodeRange = Node::agglomerateAndSelect(data, maximalNbOfCandidateAgglomerates * 1000000); nodeRange.first != nodeRange.second; ++nodeRange.first)
 	{
 #ifdef OUTPUT
-	  bool isFirst = true;
-	  for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
+	  if (isOutputBinary)
 	    {
-	      if (isFirst)
-		{
-		  isFirst = false;
-		}
-	      else
-		{
-		  outputFile << outputDimensionSeparator;
-		}
-	      bool isFirstElement = true;
-	      const Attribute& attribute = *attributes[internalAttributeId];
-	      for (const unsigned int id : (*nodeRange.first)->dimension(internalAttributeId))
-		{
-		  if (isFirstElement)
-		    {
-		      isFirstElement = false;
-		    }
-		  else
-		    {
-		      Attribute::printOutputElementSeparator(outputFile);
-		    }
-		  attribute.printValueFromDataId(id, outputFile);
-		}
+	      writeAgglomerate(**nodeRange.first, out);
 	    }
-	  if (isSizePrinted)
-	    {
-	      outputFile << patternSizeSeparator;
-	      isFirst = true;
-	      for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
-		{
-		  if (isFirst)
-		    {
-		      isFirst = false;
-		    }
-		  else
-		    {
-		      outputFile << sizeSeparator;
-		    }
-		  outputFile << (*nodeRange.first)->dimension(internalAttributeId).size();
-		}
-	    }
-	  if (isAreaPrinted)
+	  else
 	    {
-	      outputFile << sizeAreaSeparator << (*nodeRange.first)->getArea();
+	      printAgglomerate(**nodeRange.first, out);
 	    }
-	  outputFile << endl;
 #endif
 	  delete *nodeRange.first;
 	}
@@ -1064,6 +1194,20 @@ void Tree::terminate(const double maximalNbOfCandidateAgglomerates)
       agglomerationDuration = duration_cast<duration<double>>(steady_clock::now() - startingPoint).count();
 #endif
     }
+#ifdef OUTPUT
+  if (isOutputBinary)
+    {
+      // The labels follow every pattern
+      const unsigned long long labelsOffset = outputFile.handOverAll();
+      vector<const vector<string>*> labelsPerDimension;
+      labelsPerDimension.reserve(external2InternalAttributeOrder.size());
+      for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
+	{
+	  labelsPerDimension.push_back(&Attribute::getLabels(internalAttributeId));
+	}
+      BinaryPatternFile::writeLabelsAndFooter(labelsPerDimension, labelsOffset, Attribute::noisePrinted(), outputFile.stream());
+    }
+#endif
   outputFile.close();
   delete data;
 #ifdef GNUPLOT
@@ -1119,19 +1263,85 @@ void Tree::terminate(const double maximalNbOfCandidateAgglomerates)
 #endif
 }
 
-const bool Tree::leftSubtree(const Attribute& presentAttribute) const
+const bool Tree::leftSubtree(const Attribute& presentAttribute)
 {
   const unsigned int presentAttributeId = presentAttribute.getId();
   vector<Measure*> childMereConstraints = childMeasures(mereConstraints, presentAttributeId, presentAttribute.getChosenValue().getDataId());
   if (childMereConstraints.size() == mereConstraints.size())
     {
+      if (threadPool)
+	{
+	  unsigned int nbOfPotentialElements = 0;
+	  for (const Attribute* attribute : attributes)
+	    {
+	      nbOfPotentialElements += attribute->sizeOfPresentAndPotential() - attribute->sizeOfPresent();
+	    }
+	  if (nbOfPotentialElements >= minNbOfPotentialElementsInTask)
+	    {
+	      // The left subtree becomes a task, whose result is unknown when the right subtree is mined: the enumerated element is considered potentially preventing closedness
+	      threadPool->submit(LeftSubtreeTask(new Tree(*this, childMereConstraints), presentAttributeId));
+	      return true;
+	    }
+	}
+#ifdef TRAIL
+      const bool isLeftChildEnumeratedElementPotentiallyPreventingClosedness = setPresentInPlace(presentAttributeId, childMereConstraints);
+      deleteMeasures(childMereConstraints);
+      return isLeftChildEnumeratedElementPotentiallyPreventingClosedness;
+#else
       Tree leftChild(*this, childMereConstraints);
       leftChild.setPresent(presentAttributeId);
       return leftChild.isEnumeratedElementPotentiallyPreventingClosedness;
+#endif
     }
   return true;
 }
 
+#ifdef TRAIL
+const bool Tree::setPresentInPlace(const unsigned int presentAttributeId, vector<Measure*>& childMereConstraints)
+{
+#ifdef NB_OF_LEFT_NODES
+  ++nbOfLeftNodes;
+#endif
+  // The left subtree is explored on the attributes of this node: their states are saved, the noise counters modified in the subtree are recorded on the trail and everything is restored afterwards
+  vector<Attribute::State> states;
+  states.reserve(attributes.size());
+  for (Attribute* attribute : attributes)
+    {
+      states.push_back(attribute->getState());
+      attribute->becomeChild();
+    }
+  const bool isEnumeratedElementPotentiallyPreventingClosednessInParent = isEnumeratedElementPotentiallyPreventingClosedness;
+  isEnumeratedElementPotentiallyPreventingClosedness = false;
+  mereConstraints.swap(childMereConstraints);
+  Trail::mark();
+  setPresent(presentAttributeId);
+  Trail::rollback();
+  mereConstraints.swap(childMereConstraints);
+  vector<Attribute::State>::iterator stateIt = states.begin();
+  for (Attribute* attribute : attributes)
+    {
+      attribute->setState(std::move(*stateIt++));
+    }
+  const bool isLeftChildEnumeratedElementPotentiallyPreventingClosedness = isEnumeratedElementPotentiallyPreventingClosedness;
+  isEnumeratedElementPotentiallyPreventingClosedness = isEnumeratedElementPotentiallyPreventingClosednessInParent;
+  return isLeftChildEnumeratedElementPotentiallyPreventingClosedness;
+}
+#endif
+
+Tree::LeftSubtreeTask::LeftSubtreeTask(Tree* leftChildParam, const unsigned int presentAttributeIdParam): leftChild(leftChildParam), presentAttributeId(presentAttributeIdParam), detachedFirstTupleMeasures(), detachedPresentAndPotential(), detachedFirstGroupMeasures(), detachedGroupCovers()
+{
+  TupleMeasure::detachLastState(detachedFirstTupleMeasures, detachedPresentAndPotential);
+  GroupMeasure::detachLastState(detachedFirstGroupMeasures, detachedGroupCovers);
+}
+
+void Tree::LeftSubtreeTask::operator()()
+{
+  TupleMeasure::attachState(detachedFirstTupleMeasures, detachedPresentAndPotential);
+  GroupMeasure::attachState(detachedFirstGroupMeasures, detachedGroupCovers);
+  leftChild->setPresent(presentAttributeId);
+  delete leftChild;
+}
+
 vector<Measure*> Tree::childMeasures(const vector<Measure*>& parentMeasures, const unsigned int presentAttributeId, const unsigned int presentValueId)
 {
   vector<Measure*> childMeasures;
@@ -1451,15 +1661,21 @@ void Tree::validPattern() const
 {
   if (isAgglomeration)
     {
+      lock_guard<mutex> lock(outputLock);
       new Node(attributes);
     }
 #ifdef OUTPUT
+  else if (isOutputBinary)
+    {
+      writePattern(outputFile.stream());
+    }
   else
     {
-      outputFile << *this;
+      ostream& out = outputFile.stream();
+      out << *this;
       if (isSizePrinted)
 	{
-	  outputFile << patternSizeSeparator;
+	  out << patternSizeSeparator;
 	  bool isFirstSize = true;
 	  for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
 	    {
@@ -1469,9 +1685,9 @@ void Tree::validPattern() const
 		}
 	      else
 		{
-		  outputFile << sizeSeparator;
+		  out << sizeSeparator;
 		}
-	      outputFile << attributes[internalAttributeId]->sizeOfPresent();
+	      out << attributes[internalAttributeId]->sizeOfPresent();
 	    }
 	}
       if (isAreaPrinted)
@@ -1481,13 +1697,90 @@ void Tree::validPattern() const
 	    {
 	      area *= attribute->sizeOfPresent();
 	    }
-	  outputFile << sizeAreaSeparator << area;
+	  out << sizeAreaSeparator << area;
 	}
-      outputFile << endl;
+      out << endl;
     }
 #endif
 }
 
+void Tree::writePattern(ostream& out) const
+{
+  unsigned long long area = 1;
+  for (const Attribute* attribute : attributes)
+    {
+      area *= attribute->sizeOfPresent();
+    }
+  BinaryPatternFile::writeArea(area, out);
+  for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
+    {
+      attributes[internalAttributeId]->writePresent(out);
+    }
+  out.flush();
+}
+
+void Tree::printAgglomerate(const Node& agglomerate, ostream& out) const
+{
+  bool isFirst = true;
+  for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
+    {
+      if (isFirst)
+	{
+	  isFirst = false;
+	}
+      else
+	{
+	  out << outputDimensionSeparator;
+	}
+      bool isFirstElement = true;
+      const Attribute& attribute = *attributes[internalAttributeId];
+      for (const unsigned int id : agglomerate.dimension(internalAttributeId))
+	{
+	  if (isFirstElement)
+	    {
+	      isFirstElement = false;
+	    }
+	  else
+	    {
+	      Attribute::printOutputElementSeparator(out);
+	    }
+	  attribute.printValueFromDataId(id, out);
+	}
+    }
+  if (isSizePrinted)
+    {
+      out << patternSizeSeparator;
+      isFirst = true;
+      for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
+	{
+	  if (isFirst)
+	    {
+	      isFirst = false;
+	    }
+	  else
+	    {
+	      out << sizeSeparator;
+	    }
+	  out << agglomerate.dimension(internalAttributeId).size();
+	}
+    }
+  if (isAreaPrinted)
+    {
+      out << sizeAreaSeparator << agglomerate.getArea();
+    }
+  out << endl;
+}
+
+void Tree::writeAgglomerate(const Node& agglomerate, ostream& out) const
+{
+  BinaryPatternFile::writeArea(agglomerate.getArea(), out);
+  for (const unsigned int internalAttributeId : external2InternalAttributeOrder)
+    {
+      BinaryPatternFile::writeIds(agglomerate.dimension(internalAttributeId), out);
+    }
+  out.flush();
+}
+
 void Tree::setMinParametersInClique(vector<unsigned int>& parameterVector)
 {
   if (firstSymmetricAttributeId != numeric_limits<unsigned int>::max())
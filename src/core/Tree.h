@@ -30,8 +30,11 @@
 #include "Trie.h"
 #include "NoisyTupleFileReader.h"
 #include "NoisyTuples.h"
+#include "ReducedDataFile.h"
 #include "IndistinctSkyPatterns.h"
 #include "Node.h"
+#include "../utilities/WorkStealingPool.h"
+#include "../utilities/BufferedOutputFile.h"
 
 #if defined TIME || defined DETAILED_TIME
 #include <chrono>
@@ -45,7 +48,7 @@ class Tree
   Tree() = delete;
   Tree(const Tree&) = delete;
   Tree(Tree&&) = delete;
-  Tree(const char* dataFileName, const float densityThreshold, const double shiftMultiplier, const vector<double>& epsilonVector, const vector<unsigned int>& cliqueDimensions, const vector<double>& tauVector, const vector<unsigned int>& minSizes, const unsigned int minArea, const bool isReductionOnly, const bool isAgglomeration, const vector<unsigned int>& unclosedDimensions, const char* inputElementSeparator, const char* inputDimensionSeparator, const char* outputFileName, const char* outputDimensionSeparator, const char* patternSizeSeparator, const char* sizeSeparator, const char* sizeAreaSeparator, const bool isSizePrinted, const bool isAreaPrinted);
+  Tree(const char* dataFileName, const float densityThreshold, const double shiftMultiplier, const vector<double>& epsilonVector, const vector<unsigned int>& cliqueDimensions, const vector<double>& tauVector, const vector<unsigned int>& minSizes, const unsigned int minArea, const bool isReductionOnly, const char* savedReducedDataFileName, const char* loadedReducedDataFileName, const bool isAgglomeration, const vector<unsigned int>& unclosedDimensions, const char* inputElementSeparator, const char* inputDimensionSeparator, const char* outputFileName, const char* outputDimensionSeparator, const char* patternSizeSeparator, const char* sizeSeparator, const char* sizeAreaSeparator, const bool isSizePrinted, const bool isAreaPrinted, const bool isOutputBinary);
 
   virtual ~Tree();
 
@@ -53,10 +56,11 @@ class Tree
   Tree& operator=(Tree&&) = delete;
 
   void initMeasures(const vector<unsigned int>& maxSizes, const int maxArea, const vector<string>& groupFileNames, const vector<unsigned int>& groupMinSizes, const vector<unsigned int>& groupMaxSizes, const vector<vector<float>>& groupMinRatios, const vector<vector<float>>& groupMinPiatetskyShapiros, const vector<vector<float>>& groupMinLeverages, const vector<vector<float>>& groupMinForces, const vector<vector<float>>& groupMinYulesQs, const vector<vector<float>>& groupMinYulesYs, const char* groupElementSeparator, const char* groupDimensionElementsSeparator, const char* utilityValueFileName, const float minUtility, const char* valueElementSeparator, const char* valueDimensionSeparator, const char* slopePointFileName, const float minSlope, const char* pointElementSeparator, const char* pointDimensionSeparator, const float densityThreshold);
-  void mine();
+  void mine(const unsigned int nbOfThreads, const unsigned int minNbOfPotentialElementsInTask);
   virtual void terminate(const double maximalNbOfCandidateAgglomerates);
 
  protected:
+  Arena arena;			/* holds the attributes and their values */
   vector<Attribute*> attributes;
   vector<Measure*> mereConstraints;
   bool isEnumeratedElementPotentiallyPreventingClosedness;
@@ -70,13 +74,17 @@ class Tree
   static double minArea;
 
   static bool isAgglomeration;
-  static ofstream outputFile;
+  static WorkStealingPool* threadPool;
+  static unsigned int minNbOfPotentialElementsInTask;
+  static mutex outputLock;
+  static BufferedOutputFile outputFile;
   static string outputDimensionSeparator;
   static string patternSizeSeparator;
   static string sizeSeparator;
   static string sizeAreaSeparator;
   static bool isSizePrinted;
   static bool isAreaPrinted;
+  static bool isOutputBinary;
 
 #ifdef TIME
   static steady_clock::time_point overallBeginning;
@@ -91,12 +99,29 @@ class Tree
 #endif
   // CLEAN: All these static attributes should not be static for a detailed analysis of the enumeration
 #ifdef NB_OF_LEFT_NODES
-  static unsigned int nbOfLeftNodes;
+  static atomic<unsigned int> nbOfLeftNodes;
 #endif
 #ifdef NB_OF_CLOSED_N_SETS
-  static unsigned int nbOfClosedNSets;
+  static atomic<unsigned int> nbOfClosedNSets;
 #endif
 
+  struct LeftSubtreeTask
+  {
+    Tree* leftChild;
+    unsigned int presentAttributeId;
+    vector<TupleMeasure*> detachedFirstTupleMeasures;
+    vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>> detachedPresentAndPotential;
+    vector<GroupMeasure*> detachedFirstGroupMeasures;
+    vector<GroupCovers*> detachedGroupCovers;
+
+    LeftSubtreeTask(Tree* leftChild, const unsigned int presentAttributeId);
+    LeftSubtreeTask(const LeftSubtreeTask&) = default;
+    LeftSubtreeTask(LeftSubtreeTask&&) = default;
+    LeftSubtreeTask& operator=(const LeftSubtreeTask&) = default;
+    LeftSubtreeTask& operator=(LeftSubtreeTask&&) = default;
+    void operator()();
+  };
+
   Tree(const Tree& parent, const vector<Measure*>& mereConstraints);
 
   friend ostream& operator<<(ostream& out, const Tree& tree);
@@ -104,9 +129,16 @@ class Tree
   void printNode(ostream& out) const;
 #endif
 
+  void initFromReducedData(const ReducedDataFile& reducedData, const float densityThreshold, const double shiftMultiplier, const vector<double>& tauVector, const vector<unsigned int>& cliqueDimensions, const vector<unsigned int>& unclosedDimensions);
+  void initData(const bool isCrisp, const float densityThreshold, const vector<unsigned int>& cardinalities);
+  void setIsClosedVector(const double shiftMultiplier, const unsigned int largestNoise, const vector<unsigned int>& unclosedDimensions, const unsigned int nbOfSymmetricAttributes) const;
+
   void peel();
 
-  virtual const bool leftSubtree(const Attribute& presentAttribute) const;
+  virtual const bool leftSubtree(const Attribute& presentAttribute);
+#ifdef TRAIL
+  const bool setPresentInPlace(const unsigned int presentAttributeId, vector<Measure*>& childMereConstraints);
+#endif
   void rightSubtree(Attribute& absentAttribute, const bool isLastEnumeratedElementPotentiallyPreventingClosedness);
 
   void setPresent(const unsigned int presentAttributeId);
@@ -120,7 +152,12 @@ class Tree
   virtual const bool violationAfterRemoving(const unsigned int dimensionIdOfElementsSetAbsent, const vector<unsigned int>& elementsSetAbsent);
   virtual const bool dominated();
   virtual void validPattern() const;
+  void writePattern(ostream& out) const;
+  void printAgglomerate(const Node& agglomerate, ostream& out) const;
+  void writeAgglomerate(const Node& agglomerate, ostream& out) const;
 
+  static void setAttributeOrder(const vector<unsigned int>& internal2ExternalAttributeOrder, const vector<unsigned int>& cliqueDimensions);
+  static const unsigned int setNoisePerUnit(const vector<unsigned int>& cardinalities, const bool isCrisp); /* returns the largest noise */
   static void setMinParametersInClique(vector<unsigned int>& parameterVector);
   static void setMaxParametersInClique(vector<unsigned int>& parameterVector);
   static vector<Measure*> childMeasures(const vector<Measure*>& parentMeasures, const unsigned int presentAttributeId, const unsigned int presentValueId);
@@ -8,21 +8,27 @@
 
 // You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
 
-#include "Trie.h"
+#include "StaticDispatch.h"
 
 bool Trie::isCrisp = false;
+unsigned int Trie::nbOfMembershipBits = 32;
+unsigned int Trie::membershipQuantum = 1;
 NoNoiseTube Trie::noNoiseTube = NoNoiseTube();
 
-Trie::Trie(const Trie& otherTrie): hyperplanes()
+Trie::Trie(): AbstractData(trieData), hyperplanes()
+{
+}
+
+Trie::Trie(const Trie& otherTrie): AbstractData(trieData), hyperplanes()
 {
   copy(otherTrie);
 }
 
-Trie::Trie(Trie&& otherTrie): hyperplanes(std::move(otherTrie.hyperplanes))
+Trie::Trie(Trie&& otherTrie): AbstractData(trieData), hyperplanes(std::move(otherTrie.hyperplanes))
 {
 }
 
-Trie::Trie(const vector<unsigned int>::const_iterator cardinalityIt, const vector<unsigned int>::const_iterator cardinalityEnd): hyperplanes()
+Trie::Trie(const vector<unsigned int>::const_iterator cardinalityIt, const vector<unsigned int>::const_iterator cardinalityEnd): AbstractData(trieData), hyperplanes()
 {
   const unsigned int cardinality = *cardinalityIt;
   hyperplanes.reserve(cardinality);
@@ -118,78 +124,91 @@ void Trie::print(vector<unsigned int>& prefix, ostream& out) const
     }
 }
 
-void Trie::setHyperplane(const unsigned int hyperplaneOldId, const unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator begin, const unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator end, const vector<unsigned int>& attributeOrder, const vector<vector<unsigned int>>& oldIds2NewIds, vector<Attribute*>& attributes)
+Trie* Trie::compress()
 {
-  const vector<Attribute*>::iterator nextAttributeIt = attributes.begin() + 1;
-  const unsigned int hyperplaneId = oldIds2NewIds.front().at(hyperplaneOldId);
-  AbstractData* hyperplane = hyperplanes[hyperplaneId];
-  for (unordered_map<vector<unsigned int>, double, vector_hash<unsigned int>>::const_iterator tupleIt = begin; tupleIt != end; ++tupleIt)
-    {
-      vector<vector<vector<unsigned int>>::iterator> intersectionIts;
-      intersectionIts.reserve(attributeOrder.size());
-      intersectionIts.push_back(attributes.front()->getIntersectionsBeginWithPotentialValues(hyperplaneId));
-      const unsigned int membership = ceil(tupleIt->second * Attribute::noisePerUnit); // ceil to guarantee that every pattern to be returned is returned
-      if (hyperplane->setTuple(tupleIt->first, membership, attributeOrder.begin(), ++oldIds2NewIds.begin(), nextAttributeIt, intersectionIts))
-	{
-	  AbstractData* newHyperplane;
-	  if (isCrisp)
-	    {
-	      newHyperplane = new DenseCrispTube(static_cast<SparseCrispTube&>(*hyperplane), (*nextAttributeIt)->sizeOfPresentAndPotential());
-	    }
-	  else
+  for (AbstractData*& hyperplane : hyperplanes)
+    {
+      if (hyperplane != &noNoiseTube)
+	{
+	  AbstractData* compressedHyperplane = hyperplane->compress();
+	  if (compressedHyperplane != hyperplane)
 	    {
-	      newHyperplane = new DenseFuzzyTube(static_cast<SparseFuzzyTube&>(*hyperplane), (*nextAttributeIt)->sizeOfPresentAndPotential());
+	      delete hyperplane;
+	      hyperplane = compressedHyperplane;
 	    }
-	  delete hyperplane;
-	  hyperplane = newHyperplane;
-	  hyperplanes[hyperplaneId] = hyperplane;
 	}
-      attributes.front()->substractPotentialNoise(hyperplaneId, membership);
     }
+  return this;
+}
+
+void Trie::setNoisyTuple(const unsigned int hyperplaneId, const vector<unsigned int>& tuple, const double membership, const vector<unsigned int>& attributeOrder, const vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, vector<Attribute*>& attributes)
+{
+  const vector<Attribute*>::iterator nextAttributeIt = attributes.begin() + 1;
+  AbstractData*& hyperplane = hyperplanes[hyperplaneId];
+  vector<Intersections::iterator> intersectionIts;
+  intersectionIts.reserve(attributeOrder.size());
+  intersectionIts.push_back(attributes.front()->getIntersectionsBeginWithPotentialValues(hyperplaneId));
+  const unsigned int quantizedMembership = membershipQuantum * ceil(membership * (Attribute::noisePerUnit / membershipQuantum)); // ceil to guarantee that every pattern to be returned is returned
+  if (hyperplane->setTuple(tuple, quantizedMembership, attributeOrder.begin(), oldIds2NewIdsIt, nextAttributeIt, intersectionIts))
+    {
+      AbstractData* newHyperplane;
+      if (isCrisp)
+	{
+	  newHyperplane = new DenseCrispTube(static_cast<SparseCrispTube&>(*hyperplane), (*nextAttributeIt)->sizeOfPresentAndPotential());
+	}
+      else
+	{
+	  newHyperplane = newDenseFuzzyTube(static_cast<SparseFuzzyTube&>(*hyperplane), (*nextAttributeIt)->sizeOfPresentAndPotential());
+	}
+      delete hyperplane;
+      hyperplane = newHyperplane;
+    }
+  attributes.front()->substractPotentialNoise(hyperplaneId, quantizedMembership);
 }
 
 void Trie::setSelfLoops(const unsigned int firstSymmetricAttributeId, const unsigned int lastSymmetricAttributeId, vector<Attribute*>& attributes)
 {
-  vector<vector<vector<unsigned int>>::iterator> intersectionIts;
+  vector<Intersections::iterator> intersectionIts;
   intersectionIts.reserve(Attribute::lastAttributeId());
   setSelfLoopsBeforeSymmetricAttributes(firstSymmetricAttributeId, lastSymmetricAttributeId, attributes.begin(), intersectionIts, 0);
 }
 
 void Trie::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeBegin) const
 {
-  vector<vector<vector<unsigned int>>::iterator> intersectionIts;
+  vector<Intersections::iterator> intersectionIts;
   intersectionIts.reserve(Attribute::lastAttributeId());
   setPresent(presentAttributeIt, attributeBegin, intersectionIts);
 }
 
 void Trie::setSymmetricPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeBegin) const
 {
-  vector<vector<vector<unsigned int>>::iterator> intersectionIts;
+  vector<Intersections::iterator> intersectionIts;
   intersectionIts.reserve(Attribute::lastAttributeId());
   setSymmetricPresent(presentAttributeIt, attributeBegin, intersectionIts);
 }
 
 void Trie::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeBegin) const
 {
-  vector<vector<vector<unsigned int>>::iterator> intersectionIts;
+  vector<Intersections::iterator> intersectionIts;
   intersectionIts.reserve(Attribute::lastAttributeId());
+  DenseCrispTube::forgetValueMask();
   setAbsent(absentAttributeIt, absentValueDataIds, attributeBegin, intersectionIts);
 }
 
 void Trie::setSymmetricAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator attributeBegin) const
 {
-  vector<vector<vector<unsigned int>>::iterator> intersectionIts;
+  vector<Intersections::iterator> intersectionIts;
   intersectionIts.reserve(Attribute::lastAttributeId());
   setSymmetricAbsent(absentAttributeIt, attributeBegin, intersectionIts);
 }
 
-const bool Trie::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts)
+const bool Trie::setTuple(const vector<unsigned int>& tuple, const unsigned int membership, vector<unsigned int>::const_iterator attributeIdIt, vector<vector<unsigned int>>::const_iterator oldIds2NewIdsIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
 {
   const unsigned int element = oldIds2NewIdsIt->at(tuple[*attributeIdIt]);
   (*attributeIt)->substractPotentialNoise(element, membership);
-  for (vector<vector<unsigned int>>::iterator& intersectionIt : intersectionIts)
+  for (Intersections::iterator& intersectionIt : intersectionIts)
     {
-      (*intersectionIt)[element] -= membership;
+      Trail::decrease((*intersectionIt)[element], membership);
       ++intersectionIt;
     }
   intersectionIts.push_back((*attributeIt)->getIntersectionsBeginWithPotentialValues(element));
@@ -204,7 +223,7 @@ const bool Trie::setTuple(const vector<unsigned int>& tuple, const unsigned int
 	}
       else
 	{
-	  newHyperplane = new DenseFuzzyTube(static_cast<SparseFuzzyTube&>(*hyperplane), (*nextAttributeIt)->sizeOfPresentAndPotential());
+	  newHyperplane = newDenseFuzzyTube(static_cast<SparseFuzzyTube&>(*hyperplane), (*nextAttributeIt)->sizeOfPresentAndPotential());
 	}
       delete hyperplane;
       hyperplane = newHyperplane;
@@ -217,12 +236,55 @@ void Trie::setCrisp()
   isCrisp = true;
 }
 
+void Trie::setNbOfMembershipBits(const unsigned int nbOfMembershipBitsParam)
+{
+  nbOfMembershipBits = nbOfMembershipBitsParam;
+}
+
+void Trie::quantizeMemberships()
+{
+  if (nbOfMembershipBits < 32)
+    {
+      // Every noise becomes a multiple of membershipQuantum, which a dense fuzzy tube stores divided by membershipQuantum
+      const unsigned int nbOfLevels = (1u << nbOfMembershipBits) - 1;
+      if (Attribute::noisePerUnit > nbOfLevels)
+	{
+	  membershipQuantum = Attribute::noisePerUnit / nbOfLevels;
+	  Attribute::noisePerUnit = membershipQuantum * nbOfLevels;
+	}
+      if (nbOfMembershipBits == 8)
+	{
+	  DenseFuzzyTube<unsigned char>::setNoiseQuantum(membershipQuantum);
+	  return;
+	}
+      DenseFuzzyTube<unsigned short>::setNoiseQuantum(membershipQuantum);
+    }
+}
+
+const double Trie::numericPrecision()
+{
+  return static_cast<double>(membershipQuantum) / Attribute::noisePerUnit;
+}
+
+AbstractData* Trie::newDenseFuzzyTube(const SparseFuzzyTube& sparseFuzzyTube, const unsigned int size)
+{
+  if (nbOfMembershipBits == 8)
+    {
+      return new DenseFuzzyTube<unsigned char>(sparseFuzzyTube, size);
+    }
+  if (nbOfMembershipBits == 16)
+    {
+      return new DenseFuzzyTube<unsigned short>(sparseFuzzyTube, size);
+    }
+  return new DenseFuzzyTube<unsigned int>(sparseFuzzyTube, size);
+}
+
 // PERF: The amount of noise in every counter could be set at the construction of the attributes (but the time to insert the self loops is negligible)
-const unsigned int Trie::setSelfLoopsBeforeSymmetricAttributes(const unsigned int firstSymmetricAttributeId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, const unsigned int dimensionId)
+const unsigned int Trie::setSelfLoopsBeforeSymmetricAttributes(const unsigned int firstSymmetricAttributeId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId)
 {
   unsigned int noiseInSelfLoops = 0;
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   vector<AbstractData*>::iterator hyperplaneIt = hyperplanes.begin();
   for (unsigned int hyperplaneId = 0; hyperplaneId != hyperplanes.size(); ++hyperplaneId)
     {
@@ -237,9 +299,9 @@ const unsigned int Trie::setSelfLoopsBeforeSymmetricAttributes(const unsigned in
 	  noiseInSelfLoopsInHyperplane = static_cast<Trie*>(*hyperplaneIt)->setSelfLoopsBeforeSymmetricAttributes(firstSymmetricAttributeId, lastSymmetricAttributeId, nextAttributeIt, nextIntersectionIts, dimensionId + 1);
 	}
       ++hyperplaneIt;
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[hyperplaneId] -= noiseInSelfLoopsInHyperplane;
+	  Trail::decrease((*intersectionIt)[hyperplaneId], noiseInSelfLoopsInHyperplane);
 	}
       (*attributeIt)->substractPotentialNoise(hyperplaneId, noiseInSelfLoopsInHyperplane);
       noiseInSelfLoops += noiseInSelfLoopsInHyperplane;
@@ -249,10 +311,10 @@ const unsigned int Trie::setSelfLoopsBeforeSymmetricAttributes(const unsigned in
 }
 
 // PERF: The amount of noise in every counter could be set at the construction of the attributes (but the time to insert the self loops is negligible)
-const unsigned int Trie::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, const unsigned int dimensionId)
+const unsigned int Trie::setSelfLoopsInSymmetricAttribute(const unsigned int hyperplaneId, const unsigned int lastSymmetricAttributeId, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts, const unsigned int dimensionId)
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   AbstractData*& hyperplane = hyperplanes[hyperplaneId];
   nextIntersectionIts.push_back((*attributeIt)->getIntersectionsBeginWithPotentialValues(hyperplaneId));
   unsigned int noiseInSelfLoopsInHyperplane;
@@ -271,9 +333,9 @@ const unsigned int Trie::setSelfLoopsInSymmetricAttribute(const unsigned int hyp
     {
       noiseInSelfLoopsInHyperplane = hyperplane->setSelfLoopsInSymmetricAttribute(hyperplaneId, lastSymmetricAttributeId, nextAttributeIt, nextIntersectionIts, dimensionId + 1);
     }
-  for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+  for (Intersections::iterator intersectionIt : intersectionIts)
     {
-      (*intersectionIt)[hyperplaneId] -= noiseInSelfLoopsInHyperplane;
+      Trail::decrease((*intersectionIt)[hyperplaneId], noiseInSelfLoopsInHyperplane);
     }
   (*attributeIt)->substractPotentialNoise(hyperplaneId, noiseInSelfLoopsInHyperplane);
   nextIntersectionIts.pop_back();
@@ -281,11 +343,11 @@ const unsigned int Trie::setSelfLoopsInSymmetricAttribute(const unsigned int hyp
 }
 
 // PERF: The amount of noise in every counter could be set at the construction of the attributes (but the time to insert the self loops is negligible)
-const unsigned int Trie::setSelfLoopsAfterSymmetricAttributes(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts)
+const unsigned int Trie::setSelfLoopsAfterSymmetricAttributes(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
 {
   unsigned int noiseInSelfLoops = 0;
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   vector<AbstractData*>::iterator hyperplaneIt = hyperplanes.begin();
   for (unsigned int hyperplaneId = 0; hyperplaneId != hyperplanes.size(); ++hyperplaneId)
     {
@@ -299,9 +361,9 @@ const unsigned int Trie::setSelfLoopsAfterSymmetricAttributes(const vector<Attri
 	  noiseInSelfLoopsInHyperplane = Attribute::noisePerUnit * (*nextAttributeIt)->sizeOfPresentAndPotential();
 	}
       ++hyperplaneIt;
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[hyperplaneId] -= noiseInSelfLoopsInHyperplane;
+	  Trail::decrease((*intersectionIt)[hyperplaneId], noiseInSelfLoopsInHyperplane);
 	}
       (*attributeIt)->substractPotentialNoise(hyperplaneId, noiseInSelfLoopsInHyperplane);
       noiseInSelfLoops += noiseInSelfLoopsInHyperplane;
@@ -310,24 +372,24 @@ const unsigned int Trie::setSelfLoopsAfterSymmetricAttributes(const vector<Attri
   return noiseInSelfLoops;
 }
 
-const unsigned int Trie::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int Trie::setPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   if (attributeIt == presentAttributeIt)
     {
       Value& presentValue = (*presentAttributeIt)->getChosenValue();
       nextIntersectionIts.push_back(presentValue.getIntersectionsBeginWithPresentValues());
-      return hyperplanes[presentValue.getDataId()]->setPresentAfterPresentValueMet(nextAttributeIt, nextIntersectionIts);
+      return dispatch(*hyperplanes[presentValue.getDataId()], setPresentAfterPresentValueMetOperation{nextAttributeIt, nextIntersectionIts});
     }
   presentFixPotentialOrAbsentValues(**attributeIt, presentAttributeIt, nextAttributeIt, intersectionIts);
   return presentFixPresentValues(**attributeIt, presentAttributeIt, nextAttributeIt, nextIntersectionIts);
 }
 
-const unsigned int Trie::setSymmetricPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int Trie::setSymmetricPresent(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   if (attributeIt == presentAttributeIt)
     {
       // *this necessarily relates to the first symmetric attribute
@@ -335,67 +397,67 @@ const unsigned int Trie::setSymmetricPresent(const vector<Attribute*>::iterator
       const unsigned int newNoise = presentFixPresentValues(**attributeIt, nextAttributeIt, nextAttributeIt, nextIntersectionIts);
       Value& presentValue = (*presentAttributeIt)->getChosenValue();
       nextIntersectionIts.push_back(presentValue.getIntersectionsBeginWithPresentValues());
-      return newNoise + hyperplanes[presentValue.getDataId()]->setSymmetricPresentAfterPresentValueMet(nextAttributeIt, nextIntersectionIts);
+      return newNoise + dispatch(*hyperplanes[presentValue.getDataId()], setSymmetricPresentAfterPresentValueMetOperation{nextAttributeIt, nextIntersectionIts});
     }
   presentFixPotentialOrAbsentValuesBeforeSymmetricAttributes(**attributeIt, presentAttributeIt, nextAttributeIt, intersectionIts);
   return presentFixPresentValuesBeforeSymmetricAttributes(**attributeIt, presentAttributeIt, nextAttributeIt, nextIntersectionIts);
 }
 
-const unsigned int Trie::setPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int Trie::setPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   presentFixPotentialOrAbsentValuesAfterPresentValueMet(**attributeIt, nextAttributeIt, intersectionIts);
   return presentFixPresentValuesAfterPresentValueMet(**attributeIt, nextAttributeIt, nextIntersectionIts);
 }
 
-const unsigned int Trie::setSymmetricPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int Trie::setSymmetricPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the second symmetric attribute
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(**attributeIt, nextAttributeIt, intersectionIts);
   return presentFixPresentValuesAfterPresentValueMet(**attributeIt, nextAttributeIt, nextIntersectionIts);
 }
 
-const unsigned int Trie::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int Trie::setPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   if (attributeIt == presentAttributeIt)
     {
       const Value& presentValue = (*presentAttributeIt)->getChosenValue();
-      const unsigned int newNoiseInHyperplane = hyperplanes[presentValue.getDataId()]->setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(attributeIt + 1, potentialOrAbsentValueIntersectionIt + 1);
-      (*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()] += newNoiseInHyperplane;
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[presentValue.getDataId()], setPresentAfterPresentValueMetAndPotentialOrAbsentUsedOperation{attributeIt + 1, potentialOrAbsentValueIntersectionIt + 1});
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()], newNoiseInHyperplane);
       return newNoiseInHyperplane;
     }
   return presentFixPresentValuesAfterPotentialOrAbsentUsed(**attributeIt, presentAttributeIt, attributeIt + 1, potentialOrAbsentValueIntersectionIt, potentialOrAbsentValueIntersectionIt + 1);
 }
 
-const unsigned int Trie::setSymmetricPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int Trie::setSymmetricPresentAfterPotentialOrAbsentUsed(const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   if (attributeIt == presentAttributeIt)
     {
       // *this necessarily relates to the first symmetric attribute
       const Value& presentValue = (*presentAttributeIt)->getChosenValue();
-      const unsigned int newNoiseInHyperplane = hyperplanes[presentValue.getDataId()]->setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(attributeIt + 1, potentialOrAbsentValueIntersectionIt + 1);
-      (*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()] += newNoiseInHyperplane;
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[presentValue.getDataId()], setPresentAfterPresentValueMetAndPotentialOrAbsentUsedOperation{attributeIt + 1, potentialOrAbsentValueIntersectionIt + 1});
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[presentValue.getIntersectionId()], newNoiseInHyperplane);
       return newNoiseInHyperplane + presentFixPresentValuesAfterPotentialOrAbsentUsed(**attributeIt, presentAttributeIt + 1, attributeIt + 1, potentialOrAbsentValueIntersectionIt, potentialOrAbsentValueIntersectionIt + 1);
     }
   return presentFixPresentValuesBeforeSymmetricAttributesAfterPotentialOrAbsentUsed(**attributeIt, presentAttributeIt, attributeIt + 1, potentialOrAbsentValueIntersectionIt, potentialOrAbsentValueIntersectionIt + 1);
 }
 
-const unsigned int Trie::setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+const unsigned int Trie::setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
   return presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(**attributeIt, attributeIt + 1, potentialOrAbsentValueIntersectionIt, potentialOrAbsentValueIntersectionIt + 1);
 }
 
-const unsigned int Trie::presentFixPresentValues(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& nextIntersectionIts) const
+const unsigned int Trie::presentFixPresentValues(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& nextIntersectionIts) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
       nextIntersectionIts.push_back((*valueIt)->getIntersectionsBeginWithPresentValues());
-      const unsigned int newNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setPresent(presentAttributeIt, nextAttributeIt, nextIntersectionIts);
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setPresentOperation{presentAttributeIt, nextAttributeIt, nextIntersectionIts});
       nextIntersectionIts.pop_back();
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       newNoise += newNoiseInHyperplane;
@@ -403,7 +465,7 @@ const unsigned int Trie::presentFixPresentValues(Attribute& currentAttribute, co
   return newNoise;
 }
 
-const unsigned int Trie::presentFixPresentValuesBeforeSymmetricAttributes(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& nextIntersectionIts) const
+const unsigned int Trie::presentFixPresentValuesBeforeSymmetricAttributes(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& nextIntersectionIts) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -419,14 +481,14 @@ const unsigned int Trie::presentFixPresentValuesBeforeSymmetricAttributes(Attrib
   return newNoise;
 }
 
-const unsigned int Trie::presentFixPresentValuesAfterPresentValueMet(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& nextIntersectionIts) const
+const unsigned int Trie::presentFixPresentValuesAfterPresentValueMet(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& nextIntersectionIts) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
       nextIntersectionIts.push_back((*valueIt)->getIntersectionsBeginWithPresentValues());
-      const unsigned int newNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setPresentAfterPresentValueMet(nextAttributeIt, nextIntersectionIts);
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setPresentAfterPresentValueMetOperation{nextAttributeIt, nextIntersectionIts});
       nextIntersectionIts.pop_back();
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       newNoise += newNoiseInHyperplane;
@@ -434,20 +496,20 @@ const unsigned int Trie::presentFixPresentValuesAfterPresentValueMet(Attribute&
   return newNoise;
 }
 
-const unsigned int Trie::presentFixPresentValuesAfterPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt, const vector<vector<unsigned int>>::iterator nextPotentialOrAbsentValueIntersectionIt) const
+const unsigned int Trie::presentFixPresentValuesAfterPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt, const Intersections::iterator nextPotentialOrAbsentValueIntersectionIt) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int newNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setPresentAfterPotentialOrAbsentUsed(presentAttributeIt, nextAttributeIt, nextPotentialOrAbsentValueIntersectionIt);
-      (*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()] += newNoiseInHyperplane;
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setPresentAfterPotentialOrAbsentUsedOperation{presentAttributeIt, nextAttributeIt, nextPotentialOrAbsentValueIntersectionIt});
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], newNoiseInHyperplane);
       newNoise += newNoiseInHyperplane;
     }
   return newNoise;
 }
 
-const unsigned int Trie::presentFixPresentValuesBeforeSymmetricAttributesAfterPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt, const vector<vector<unsigned int>>::iterator nextPotentialOrAbsentValueIntersectionIt) const
+const unsigned int Trie::presentFixPresentValuesBeforeSymmetricAttributesAfterPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt, const Intersections::iterator nextPotentialOrAbsentValueIntersectionIt) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -455,57 +517,57 @@ const unsigned int Trie::presentFixPresentValuesBeforeSymmetricAttributesAfterPo
     {
       // Since this is before the symmetric attributes, hyperplanes necessarily are tries
       const unsigned int newNoiseInHyperplane = static_cast<Trie*>(hyperplanes[(*valueIt)->getDataId()])->setSymmetricPresentAfterPotentialOrAbsentUsed(presentAttributeIt, nextAttributeIt, nextPotentialOrAbsentValueIntersectionIt);
-      (*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()] += newNoiseInHyperplane;
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], newNoiseInHyperplane);
       newNoise += newNoiseInHyperplane;
     }
   return newNoise;
 }
 
-const unsigned int Trie::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt, const vector<vector<unsigned int>>::iterator nextPotentialOrAbsentValueIntersectionIt) const
+const unsigned int Trie::presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt, const Intersections::iterator nextPotentialOrAbsentValueIntersectionIt) const
 {
   unsigned int newNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int newNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(nextAttributeIt, nextPotentialOrAbsentValueIntersectionIt);
-      (*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()] += newNoiseInHyperplane;
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setPresentAfterPresentValueMetAndPotentialOrAbsentUsedOperation{nextAttributeIt, nextPotentialOrAbsentValueIntersectionIt});
+      Trail::increase((*potentialOrAbsentValueIntersectionIt)[(*valueIt)->getIntersectionId()], newNoiseInHyperplane);
       newNoise += newNoiseInHyperplane;
     }
   return newNoise;
 }
 
-void Trie::presentFixPotentialOrAbsentValues(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void Trie::presentFixPotentialOrAbsentValues(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int newNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setPresentAfterPotentialOrAbsentUsed(presentAttributeIt, nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues());
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setPresentAfterPotentialOrAbsentUsedOperation{presentAttributeIt, nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues()});
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-void Trie::presentFixPotentialOrAbsentValuesInFirstSymmetricAttribute(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void Trie::presentFixPotentialOrAbsentValuesInFirstSymmetricAttribute(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   // The first potential value actually is the value set present and there is no noise to be found at the intersection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); ++valueIt != end; )
     {
-      const unsigned int newNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setPresentAfterPotentialOrAbsentUsed(nextAttributeIt, nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues());
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setPresentAfterPotentialOrAbsentUsedOperation{nextAttributeIt, nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues()});
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-void Trie::presentFixPotentialOrAbsentValuesBeforeSymmetricAttributes(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void Trie::presentFixPotentialOrAbsentValuesBeforeSymmetricAttributes(Attribute& currentAttribute, const vector<Attribute*>::iterator presentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
@@ -514,54 +576,54 @@ void Trie::presentFixPotentialOrAbsentValuesBeforeSymmetricAttributes(Attribute&
       const unsigned int newNoiseInHyperplane = static_cast<Trie*>(hyperplanes[(*valueIt)->getDataId()])->setSymmetricPresentAfterPotentialOrAbsentUsed(presentAttributeIt, nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues());
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-void Trie::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void Trie::presentFixPotentialOrAbsentValuesAfterPresentValueMet(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int newNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues());
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setPresentAfterPresentValueMetAndPotentialOrAbsentUsedOperation{nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues()});
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-void Trie::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void Trie::presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   // The first potential value actually is the value set present and there is no noise to be found at the intersection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
   for (vector<Value*>::iterator valueIt = currentAttribute.potentialBegin(); ++valueIt != end; )
     {
-      const unsigned int newNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues());
+      const unsigned int newNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setPresentAfterPresentValueMetAndPotentialOrAbsentUsedOperation{nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentValues()});
       (*valueIt)->addPresentNoise(newNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] += newNoiseInHyperplane;
+	  Trail::increase((*intersectionIt)[valueId], newNoiseInHyperplane);
 	}
     }
 }
 
-const unsigned int Trie::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int Trie::setAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   if (attributeIt == absentAttributeIt)
     {
       unsigned int oldNoise = 0;
       for (const unsigned int absentValueDataId : absentValueDataIds)
 	{
-	  oldNoise += hyperplanes[absentValueDataId]->setAbsentAfterAbsentValuesMet(nextAttributeIt, nextIntersectionIts);
+	  oldNoise += dispatch(*hyperplanes[absentValueDataId], setAbsentAfterAbsentValuesMetOperation{nextAttributeIt, nextIntersectionIts});
 	}
       return oldNoise;
     }
@@ -569,101 +631,101 @@ const unsigned int Trie::setAbsent(const vector<Attribute*>::iterator absentAttr
   return absentFixPresentOrPotentialValues(**attributeIt, absentAttributeIt, absentValueDataIds, nextAttributeIt, intersectionIts, nextIntersectionIts);
 }
 
-const unsigned int Trie::setSymmetricAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int Trie::setSymmetricAbsent(const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   if (attributeIt == absentAttributeIt)
     {
       // *this necessarily relates to the first symmetric attribute
       const unsigned int absentValueDataId = (*absentAttributeIt)->getChosenValue().getDataId();
       const vector<unsigned int> absentValueDataIds {absentValueDataId};
       absentFixAbsentValues(**attributeIt, nextAttributeIt, absentValueDataIds, nextAttributeIt, intersectionIts);
-      return hyperplanes[absentValueDataId]->setSymmetricAbsentAfterAbsentValueMet(nextAttributeIt, nextIntersectionIts) + absentFixPresentOrPotentialValuesInFirstSymmetricAttribute(**attributeIt, absentValueDataIds, nextAttributeIt, intersectionIts, nextIntersectionIts);
+      return dispatch(*hyperplanes[absentValueDataId], setSymmetricAbsentAfterAbsentValueMetOperation{nextAttributeIt, nextIntersectionIts}) + absentFixPresentOrPotentialValuesInFirstSymmetricAttribute(**attributeIt, absentValueDataIds, nextAttributeIt, intersectionIts, nextIntersectionIts);
     }
   absentFixAbsentValuesBeforeSymmetricAttributes(**attributeIt, absentAttributeIt, nextAttributeIt, intersectionIts);
   return absentFixPresentOrPotentialValuesBeforeSymmetricAttributes(**attributeIt, absentAttributeIt, nextAttributeIt, intersectionIts, nextIntersectionIts);
 }
 
-const unsigned int Trie::setAbsentAfterAbsentValuesMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int Trie::setAbsentAfterAbsentValuesMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   absentFixAbsentValuesAfterAbsentValuesMet(**attributeIt, nextAttributeIt, intersectionIts);
   return absentFixPresentOrPotentialValuesAfterAbsentValuesMet(**attributeIt, nextAttributeIt, intersectionIts, nextIntersectionIts);
 }
 
-const unsigned int Trie::setSymmetricAbsentAfterAbsentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+const unsigned int Trie::setSymmetricAbsentAfterAbsentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the second symmetric attribute
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  vector<vector<vector<unsigned int>>::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
+  vector<Intersections::iterator> nextIntersectionIts(incrementIterators(intersectionIts));
   absentFixAbsentValuesAfterAbsentValuesMet(**attributeIt, nextAttributeIt, intersectionIts);
   return absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(**attributeIt, nextAttributeIt, intersectionIts, nextIntersectionIts);
 }
 
-const unsigned int Trie::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int Trie::setAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  const vector<vector<unsigned int>>::iterator nextAbsentValueIntersectionIt = absentValueIntersectionIt + 1;
+  const Intersections::iterator nextAbsentValueIntersectionIt = absentValueIntersectionIt + 1;
   if (attributeIt == absentAttributeIt)
     {
       unsigned int oldNoise = 0;
       for (const unsigned int absentValueDataId : absentValueDataIds)
 	{
-	  oldNoise += hyperplanes[absentValueDataId]->setAbsentAfterAbsentValuesMetAndAbsentUsed(nextAttributeIt, nextAbsentValueIntersectionIt);
+	  oldNoise += dispatch(*hyperplanes[absentValueDataId], setAbsentAfterAbsentValuesMetAndAbsentUsedOperation{nextAttributeIt, nextAbsentValueIntersectionIt});
 	}
       return oldNoise;
     }
   return absentFixPresentOrPotentialValuesAfterAbsentUsed(**attributeIt, absentAttributeIt, absentValueDataIds, nextAttributeIt, absentValueIntersectionIt, nextAbsentValueIntersectionIt);
 }
 
-const unsigned int Trie::setSymmetricAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int Trie::setSymmetricAbsentAfterAbsentUsed(const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
   const vector<Attribute*>::iterator nextAttributeIt = attributeIt + 1;
-  const vector<vector<unsigned int>>::iterator nextAbsentValueIntersectionIt = absentValueIntersectionIt + 1;
+  const Intersections::iterator nextAbsentValueIntersectionIt = absentValueIntersectionIt + 1;
   if (attributeIt == absentAttributeIt)
     {
       // *this necessarily relates to the first symmetric attribute
       const unsigned int absentValueDataId = (*absentAttributeIt)->getChosenValue().getDataId();
       const vector<unsigned int> absentValueDataIds {absentValueDataId};
-      return hyperplanes[absentValueDataId]->setSymmetricAbsentAfterAbsentValueMetAndAbsentUsed(nextAttributeIt, nextAbsentValueIntersectionIt) + absentFixPresentOrPotentialValuesInFirstSymmetricAttributeAfterAbsentUsed(**attributeIt, absentValueDataIds, nextAttributeIt, absentValueIntersectionIt, nextAbsentValueIntersectionIt);
+      return dispatch(*hyperplanes[absentValueDataId], setSymmetricAbsentAfterAbsentValueMetAndAbsentUsedOperation{nextAttributeIt, nextAbsentValueIntersectionIt}) + absentFixPresentOrPotentialValuesInFirstSymmetricAttributeAfterAbsentUsed(**attributeIt, absentValueDataIds, nextAttributeIt, absentValueIntersectionIt, nextAbsentValueIntersectionIt);
     }
   return absentFixPresentOrPotentialValuesBeforeSymmetricAttributesAfterAbsentUsed(**attributeIt, absentAttributeIt, nextAttributeIt, absentValueIntersectionIt, nextAbsentValueIntersectionIt);
 }
 
-const unsigned int Trie::setAbsentAfterAbsentValuesMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int Trie::setAbsentAfterAbsentValuesMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
   return absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(**attributeIt, attributeIt + 1, absentValueIntersectionIt, absentValueIntersectionIt + 1);
 }
 
-const unsigned int Trie::setSymmetricAbsentAfterAbsentValueMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+const unsigned int Trie::setSymmetricAbsentAfterAbsentValueMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
   // *this necessarily relates to the second symmetric attribute
   return absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(**attributeIt, attributeIt + 1, absentValueIntersectionIt, absentValueIntersectionIt + 1);
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValues(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, vector<vector<vector<unsigned int>>::iterator>& nextIntersectionIts) const
+const unsigned int Trie::absentFixPresentOrPotentialValues(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts, vector<Intersections::iterator>& nextIntersectionIts) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
       nextIntersectionIts.push_back((*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsent(absentAttributeIt, absentValueDataIds, nextAttributeIt, nextIntersectionIts);
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentOperation{absentAttributeIt, absentValueDataIds, nextAttributeIt, nextIntersectionIts});
       nextIntersectionIts.pop_back();
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesInFirstSymmetricAttribute(Attribute& currentAttribute, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, vector<vector<vector<unsigned int>>::iterator>& nextIntersectionIts) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesInFirstSymmetricAttribute(Attribute& currentAttribute, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts, vector<Intersections::iterator>& nextIntersectionIts) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -671,13 +733,13 @@ const unsigned int Trie::absentFixPresentOrPotentialValuesInFirstSymmetricAttrib
   for (; valueIt != end; ++valueIt)
     {
       nextIntersectionIts.push_back((*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsent(nextAttributeIt, absentValueDataIds, nextAttributeIt, nextIntersectionIts);
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentOperation{nextAttributeIt, absentValueDataIds, nextAttributeIt, nextIntersectionIts});
       nextIntersectionIts.pop_back();
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
@@ -686,20 +748,20 @@ const unsigned int Trie::absentFixPresentOrPotentialValuesInFirstSymmetricAttrib
   while (++valueIt != end)
     {
       nextIntersectionIts.push_back((*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsent(nextAttributeIt, absentValueDataIds, nextAttributeIt, nextIntersectionIts);
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentOperation{nextAttributeIt, absentValueDataIds, nextAttributeIt, nextIntersectionIts});
       nextIntersectionIts.pop_back();
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesBeforeSymmetricAttributes(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, vector<vector<vector<unsigned int>>::iterator>& nextIntersectionIts) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesBeforeSymmetricAttributes(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts, vector<Intersections::iterator>& nextIntersectionIts) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
@@ -711,36 +773,36 @@ const unsigned int Trie::absentFixPresentOrPotentialValuesBeforeSymmetricAttribu
       nextIntersectionIts.pop_back();
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, vector<vector<vector<unsigned int>>::iterator>& nextIntersectionIts) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesAfterAbsentValuesMet(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts, vector<Intersections::iterator>& nextIntersectionIts) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
       nextIntersectionIts.push_back((*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentValuesMet(nextAttributeIt, nextIntersectionIts);
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentValuesMetOperation{nextAttributeIt, nextIntersectionIts});
       nextIntersectionIts.pop_back();
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts, vector<vector<vector<unsigned int>>::iterator>& nextIntersectionIts) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts, vector<Intersections::iterator>& nextIntersectionIts) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -748,13 +810,13 @@ const unsigned int Trie::absentFixPresentOrPotentialValuesInSecondSymmetricAttri
   for (; valueIt != end; ++valueIt)
     {
       nextIntersectionIts.push_back((*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentValuesMet(nextAttributeIt, nextIntersectionIts);
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentValuesMetOperation{nextAttributeIt, nextIntersectionIts});
       nextIntersectionIts.pop_back();
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
@@ -763,55 +825,55 @@ const unsigned int Trie::absentFixPresentOrPotentialValuesInSecondSymmetricAttri
   while (++valueIt != end)
     {
       nextIntersectionIts.push_back((*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentValuesMet(nextAttributeIt, nextIntersectionIts);
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentValuesMetOperation{nextAttributeIt, nextIntersectionIts});
       nextIntersectionIts.pop_back();
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesAfterAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt, const vector<vector<unsigned int>>::iterator nextAbsentValueIntersectionIt) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesAfterAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, const Intersections::iterator absentValueIntersectionIt, const Intersections::iterator nextAbsentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentUsed(absentAttributeIt, absentValueDataIds, nextAttributeIt, nextAbsentValueIntersectionIt);
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentUsedOperation{absentAttributeIt, absentValueDataIds, nextAttributeIt, nextAbsentValueIntersectionIt});
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesInFirstSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt, const vector<vector<unsigned int>>::iterator nextAbsentValueIntersectionIt) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesInFirstSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, const Intersections::iterator absentValueIntersectionIt, const Intersections::iterator nextAbsentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
   vector<Value*>::iterator valueIt = currentAttribute.presentBegin();
   for (; valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentUsed(nextAttributeIt, absentValueDataIds, nextAttributeIt, nextAbsentValueIntersectionIt);
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentUsedOperation{nextAttributeIt, absentValueDataIds, nextAttributeIt, nextAbsentValueIntersectionIt});
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   end = currentAttribute.irrelevantEnd();
   // The first potential value actually is the value set absent and there is no noise to be found at the intersection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
   while (++valueIt != end)
     {
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentUsed(nextAttributeIt, absentValueDataIds, nextAttributeIt, nextAbsentValueIntersectionIt);
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentUsedOperation{nextAttributeIt, absentValueDataIds, nextAttributeIt, nextAbsentValueIntersectionIt});
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }  
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesBeforeSymmetricAttributesAfterAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt, const vector<vector<unsigned int>>::iterator nextAbsentValueIntersectionIt) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesBeforeSymmetricAttributesAfterAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, const Intersections::iterator absentValueIntersectionIt, const Intersections::iterator nextAbsentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.presentEnd();
@@ -819,63 +881,63 @@ const unsigned int Trie::absentFixPresentOrPotentialValuesBeforeSymmetricAttribu
     {
       // Since this is before the symmetric attributes, hyperplanes necessarily are tries
       const unsigned int oldNoiseInHyperplane = static_cast<Trie*>(hyperplanes[(*valueIt)->getDataId()])->setSymmetricAbsentAfterAbsentUsed(absentAttributeIt, nextAttributeIt, nextAbsentValueIntersectionIt);
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt, const vector<vector<unsigned int>>::iterator nextAbsentValueIntersectionIt) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, const Intersections::iterator absentValueIntersectionIt, const Intersections::iterator nextAbsentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   const vector<Value*>::iterator end = currentAttribute.irrelevantEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.presentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentValuesMetAndAbsentUsed(nextAttributeIt, nextAbsentValueIntersectionIt);
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentValuesMetAndAbsentUsedOperation{nextAttributeIt, nextAbsentValueIntersectionIt});
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-const unsigned int Trie::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt, const vector<vector<unsigned int>>::iterator nextAbsentValueIntersectionIt) const
+const unsigned int Trie::absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, const Intersections::iterator absentValueIntersectionIt, const Intersections::iterator nextAbsentValueIntersectionIt) const
 {
   unsigned int oldNoise = 0;
   vector<Value*>::iterator end = currentAttribute.presentEnd();
   vector<Value*>::iterator valueIt = currentAttribute.presentBegin();
   for (; valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentValuesMetAndAbsentUsed(nextAttributeIt, nextAbsentValueIntersectionIt);
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentValuesMetAndAbsentUsedOperation{nextAttributeIt, nextAbsentValueIntersectionIt});
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   end = currentAttribute.irrelevantEnd();
   // The first potential value actually is the value set absent and there is no noise to be found at the intersection of a vertex (seen as an outgoing vertex) and itself (seen as an ingoing vertex)
   while (++valueIt != end)
     {
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentValuesMetAndAbsentUsed(nextAttributeIt, nextAbsentValueIntersectionIt);
-      (*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()] -= oldNoiseInHyperplane;
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentValuesMetAndAbsentUsedOperation{nextAttributeIt, nextAbsentValueIntersectionIt});
+      Trail::decrease((*absentValueIntersectionIt)[(*valueIt)->getIntersectionId()], oldNoiseInHyperplane);
       oldNoise += oldNoiseInHyperplane;
     }
   return oldNoise;
 }
 
-void Trie::absentFixAbsentValues(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void Trie::absentFixAbsentValues(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<unsigned int>& absentValueDataIds, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentUsed(absentAttributeIt, absentValueDataIds, nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentUsedOperation{absentAttributeIt, absentValueDataIds, nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues()});
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
     }
 }
 
-void Trie::absentFixAbsentValuesBeforeSymmetricAttributes(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void Trie::absentFixAbsentValuesBeforeSymmetricAttributes(Attribute& currentAttribute, const vector<Attribute*>::iterator absentAttributeIt, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
@@ -884,24 +946,24 @@ void Trie::absentFixAbsentValuesBeforeSymmetricAttributes(Attribute& currentAttr
       const unsigned int oldNoiseInHyperplane = static_cast<Trie*>(hyperplanes[(*valueIt)->getDataId()])->setSymmetricAbsentAfterAbsentUsed(absentAttributeIt, nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
     }
 }
 
-void Trie::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+void Trie::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute, const vector<Attribute*>::iterator nextAttributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   const vector<Value*>::iterator end = currentAttribute.absentEnd();
   for (vector<Value*>::iterator valueIt = currentAttribute.absentBegin(); valueIt != end; ++valueIt)
     {
-      const unsigned int oldNoiseInHyperplane = hyperplanes[(*valueIt)->getDataId()]->setAbsentAfterAbsentValuesMetAndAbsentUsed(nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues());
+      const unsigned int oldNoiseInHyperplane = dispatch(*hyperplanes[(*valueIt)->getDataId()], setAbsentAfterAbsentValuesMetAndAbsentUsedOperation{nextAttributeIt, (*valueIt)->getIntersectionsBeginWithPresentAndPotentialValues()});
       (*valueIt)->substractPotentialNoise(oldNoiseInHyperplane);
       const unsigned int valueId = (*valueIt)->getIntersectionId();
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[valueId] -= oldNoiseInHyperplane;
+	  Trail::decrease((*intersectionIt)[valueId], oldNoiseInHyperplane);
 	}
     }
 }
@@ -909,10 +971,11 @@ void Trie::absentFixAbsentValuesAfterAbsentValuesMet(Attribute& currentAttribute
 const double Trie::countNoise(const vector<vector<unsigned int>>& nSet) const
 {
   double noise = 0;
+  DenseCrispTube::forgetValueMask();
   const vector<vector<unsigned int>>::const_iterator nextDimensionIt = nSet.begin() + 1;
   for (const unsigned int id : nSet.front())
     {
-      noise += static_cast<double>(hyperplanes[id]->countNoise(nextDimensionIt));
+      noise += static_cast<double>(dispatch(*hyperplanes[id], countNoiseOperation{nextDimensionIt}));
     }
   return noise;
 }
@@ -923,20 +986,21 @@ const unsigned int Trie::countNoise(const vector<vector<unsigned int>>::const_it
   const vector<vector<unsigned int>>::const_iterator nextDimensionIt = dimensionIt + 1;
   for (const unsigned int id : *dimensionIt)
     {
-      noise += hyperplanes[id]->countNoise(nextDimensionIt);
+      noise += dispatch(*hyperplanes[id], countNoiseOperation{nextDimensionIt});
     }
   return noise;
 }
 
 const bool Trie::isBetterNSet(const double membershipThreshold, const vector<vector<unsigned int>>& nSet, vector<vector<unsigned int>::const_iterator>& tuple, double& membershipSum) const
 {
+  DenseCrispTube::forgetValueMask();
   const vector<vector<unsigned int>>::const_iterator dimensionIt = nSet.begin();
   const vector<vector<unsigned int>::const_iterator>::iterator tupleIt = tuple.begin();
   const vector<vector<unsigned int>>::const_iterator nextDimensionIt = dimensionIt + 1;
   const vector<vector<unsigned int>::const_iterator>::iterator nextTupleIt = tupleIt + 1;
   for (; *tupleIt != dimensionIt->end(); ++*tupleIt)
     {
-      if (hyperplanes[**tupleIt]->decreaseMembershipDownToThreshold(membershipThreshold, nextDimensionIt, nextTupleIt, membershipSum))
+      if (dispatch(*hyperplanes[**tupleIt], decreaseMembershipDownToThresholdOperation{membershipThreshold, nextDimensionIt, nextTupleIt, membershipSum}))
 	{
 	  if (*nextTupleIt == nextDimensionIt->end())
 	    {
@@ -955,7 +1019,7 @@ const bool Trie::decreaseMembershipDownToThreshold(const double membershipThresh
   const vector<vector<unsigned int>::const_iterator>::iterator nextTupleIt = tupleIt + 1;
   for (; *tupleIt != dimensionIt->end(); ++*tupleIt)
     {
-      if (hyperplanes[**tupleIt]->decreaseMembershipDownToThreshold(membershipThreshold, nextDimensionIt, nextTupleIt, membershipSum))
+      if (dispatch(*hyperplanes[**tupleIt], decreaseMembershipDownToThresholdOperation{membershipThreshold, nextDimensionIt, nextTupleIt, membershipSum}))
 	{
 	  if (*nextTupleIt == nextDimensionIt->end())
 	    {
@@ -1003,11 +1067,11 @@ const unsigned int Trie::countNoiseOnPresentAndPotential(const vector<Attribute*
 }
 #endif
 
-vector<vector<vector<unsigned int>>::iterator> Trie::incrementIterators(const vector<vector<vector<unsigned int>>::iterator>& iterators)
+vector<Intersections::iterator> Trie::incrementIterators(const vector<Intersections::iterator>& iterators)
 {
-  vector<vector<vector<unsigned int>>::iterator> nextIterators;
+  vector<Intersections::iterator> nextIterators;
   nextIterators.reserve(iterators.size());
-  for (const vector<vector<unsigned int>>::iterator it : iterators)
+  for (const Intersections::iterator it : iterators)
     {
       nextIterators.push_back(it + 1);
     }
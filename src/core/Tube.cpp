@@ -8,62 +8,83 @@
 
 // You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
 
-#include "Tube.h"
+#include "SparseCrispTube.h"
+#include "DenseCrispTube.h"
+#include "SparseFuzzyTube.h"
+#include "DenseFuzzyTube.h"
 
-Tube::~Tube()
+template<typename T> Tube<T>::Tube(const DataType dataType): AbstractData(dataType)
 {
 }
 
-const unsigned int Tube::setSelfLoopsAfterSymmetricAttributes(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts)
+template<typename T> Tube<T>::~Tube()
+{
+}
+
+template<typename T> const T& Tube<T>::derived() const
+{
+  return static_cast<const T&>(*this);
+}
+
+template<typename T> const unsigned int Tube<T>::setSelfLoopsAfterSymmetricAttributes(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts)
 {
   // Return 0 to trigger a switch to dense storage
   for (unsigned int hyperplaneId = 0; hyperplaneId != (*attributeIt)->sizeOfPresentAndPotential(); ++hyperplaneId)
     {
-      for (vector<vector<unsigned int>>::iterator intersectionIt : intersectionIts)
+      for (Intersections::iterator intersectionIt : intersectionIts)
 	{
-	  (*intersectionIt)[hyperplaneId] -= Attribute::noisePerUnit;
+	  Trail::decrease((*intersectionIt)[hyperplaneId], Attribute::noisePerUnit);
 	}
       (*attributeIt)->substractPotentialNoise(hyperplaneId, Attribute::noisePerUnit);
     }
   return 0;
 }
 
-const unsigned int Tube::setPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> const unsigned int Tube<T>::setPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
-  presentFixPotentialOrAbsentValuesAfterPresentValueMet(**attributeIt, intersectionIts);
-  return presentFixPresentValuesAfterPresentValueMet(**attributeIt);
+  derived().presentFixPotentialOrAbsentValuesAfterPresentValueMet(**attributeIt, intersectionIts);
+  return derived().presentFixPresentValuesAfterPresentValueMet(**attributeIt);
 }
 
-const unsigned int Tube::setSymmetricPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> const unsigned int Tube<T>::setSymmetricPresentAfterPresentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
   // *this necessarily relates to the second symmetric attribute
-  presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(**attributeIt, intersectionIts);
-  return presentFixPresentValuesAfterPresentValueMet(**attributeIt);
+  derived().presentFixPotentialOrAbsentValuesInSecondSymmetricAttribute(**attributeIt, intersectionIts);
+  return derived().presentFixPresentValuesAfterPresentValueMet(**attributeIt);
 }
 
-const unsigned int Tube::setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator potentialOrAbsentValueIntersectionIt) const
+template<typename T> const unsigned int Tube<T>::setPresentAfterPresentValueMetAndPotentialOrAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator potentialOrAbsentValueIntersectionIt) const
 {
-  return presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(**attributeIt, potentialOrAbsentValueIntersectionIt);
+  return derived().presentFixPresentValuesAfterPresentValueMetAndPotentialOrAbsentUsed(**attributeIt, potentialOrAbsentValueIntersectionIt);
 }
 
-const unsigned int Tube::setAbsentAfterAbsentValuesMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> const unsigned int Tube<T>::setAbsentAfterAbsentValuesMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
-  absentFixAbsentValuesAfterAbsentValuesMet(**attributeIt, intersectionIts);
-  return absentFixPresentOrPotentialValuesAfterAbsentValuesMet(**attributeIt, intersectionIts);
+  derived().absentFixAbsentValuesAfterAbsentValuesMet(**attributeIt, intersectionIts);
+  return derived().absentFixPresentOrPotentialValuesAfterAbsentValuesMet(**attributeIt, intersectionIts);
 }
 
-const unsigned int Tube::setSymmetricAbsentAfterAbsentValueMet(const vector<Attribute*>::iterator attributeIt, vector<vector<vector<unsigned int>>::iterator>& intersectionIts) const
+template<typename T> const unsigned int Tube<T>::setSymmetricAbsentAfterAbsentValueMet(const vector<Attribute*>::iterator attributeIt, vector<Intersections::iterator>& intersectionIts) const
 {
-  absentFixAbsentValuesAfterAbsentValuesMet(**attributeIt, intersectionIts);
-  return absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(**attributeIt, intersectionIts);
+  derived().absentFixAbsentValuesAfterAbsentValuesMet(**attributeIt, intersectionIts);
+  return derived().absentFixPresentOrPotentialValuesInSecondSymmetricAttribute(**attributeIt, intersectionIts);
 }
 
-const unsigned int Tube::setAbsentAfterAbsentValuesMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+template<typename T> const unsigned int Tube<T>::setAbsentAfterAbsentValuesMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
-  return absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(**attributeIt, absentValueIntersectionIt);
+  return derived().absentFixPresentOrPotentialValuesAfterAbsentValuesMetAndAbsentUsed(**attributeIt, absentValueIntersectionIt);
 }
 
-const unsigned int Tube::setSymmetricAbsentAfterAbsentValueMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const vector<vector<unsigned int>>::iterator absentValueIntersectionIt) const
+template<typename T> const unsigned int Tube<T>::setSymmetricAbsentAfterAbsentValueMetAndAbsentUsed(const vector<Attribute*>::iterator attributeIt, const Intersections::iterator absentValueIntersectionIt) const
 {
-  return absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(**attributeIt, absentValueIntersectionIt);
+  return derived().absentFixPresentOrPotentialValuesInSecondSymmetricAttributeAfterAbsentUsed(**attributeIt, absentValueIntersectionIt);
 }
+
+template class Tube<SparseCrispTube>;
+template class Tube<DenseCrispTube>;
+template class Tube<CompressedCrispTube>;
+template class Tube<SparseFuzzyTube>;
+template class Tube<SortedFuzzyTube>;
+template class Tube<DenseFuzzyTube<unsigned char>>;
+template class Tube<DenseFuzzyTube<unsigned short>>;
+template class Tube<DenseFuzzyTube<unsigned int>>;
@@ -10,37 +10,46 @@
 
 #include "Value.h"
 
-Value::Value(const unsigned int dataIdParam): dataId(dataIdParam), intersectionId(dataIdParam), presentNoise(0), presentAndPotentialNoise(0), intersectionsWithPresentValues(), intersectionsWithPresentAndPotentialValues()
-{
-}
+#include <algorithm>
+#include <numeric>
+
+#ifdef X86_SIMD
+#include <immintrin.h>
+#endif
+
+const Value::FutureValuesWithinThreshold Value::futureValuesWithinThreshold = Value::fastestFutureValuesWithinThreshold();
 
-Value::Value(const unsigned int dataIdParam, const unsigned int presentAndPotentialNoiseParam, const vector<unsigned int>::const_iterator nbOfValuesPerAttributeBegin, const vector<unsigned int>::const_iterator nbOfValuesPerAttributeEnd, const vector<unsigned int>& noisesInIntersections): dataId(dataIdParam), intersectionId(dataIdParam), presentNoise(0), presentAndPotentialNoise(presentAndPotentialNoiseParam), intersectionsWithPresentValues(), intersectionsWithPresentAndPotentialValues()
+Value::Value(const unsigned int dataIdParam, const unsigned int presentAndPotentialNoiseParam, const vector<unsigned int>::const_iterator nbOfValuesPerAttributeBegin, const vector<unsigned int>::const_iterator nbOfValuesPerAttributeEnd, const vector<unsigned int>& noisesInIntersections, Arena& arena): dataId(dataIdParam), intersectionId(dataIdParam), presentNoise(0), presentAndPotentialNoise(presentAndPotentialNoiseParam), intersectionsWithPresentValues(arena), intersectionsWithPresentAndPotentialValues(arena)
 {
-  intersectionsWithPresentValues.reserve(noisesInIntersections.size());
-  intersectionsWithPresentAndPotentialValues.reserve(noisesInIntersections.size());
+  allocateIntersections(nbOfValuesPerAttributeBegin, nbOfValuesPerAttributeEnd, arena);
+  Intersections::iterator intersectionsWithPresentValuesIt = intersectionsWithPresentValues.begin();
+  Intersections::iterator intersectionsWithPresentAndPotentialValuesIt = intersectionsWithPresentAndPotentialValues.begin();
   vector<unsigned int>::const_iterator sizeOfIntersectionIt = noisesInIntersections.begin();
   for (vector<unsigned int>::const_iterator nbOfValuesPerAttributeIt = nbOfValuesPerAttributeBegin; nbOfValuesPerAttributeIt != nbOfValuesPerAttributeEnd; ++nbOfValuesPerAttributeIt)
     {
-      vector<unsigned int> intersectionsWithPresent(*nbOfValuesPerAttributeIt);
-      intersectionsWithPresentValues.push_back(intersectionsWithPresent);
-      vector<unsigned int> intersectionsWithPresentAndPotential(*nbOfValuesPerAttributeIt, *sizeOfIntersectionIt++);
-      intersectionsWithPresentAndPotentialValues.push_back(intersectionsWithPresentAndPotential);
+      fill_n(*intersectionsWithPresentValuesIt++, *nbOfValuesPerAttributeIt, 0);
+      fill_n(*intersectionsWithPresentAndPotentialValuesIt++, *nbOfValuesPerAttributeIt, *sizeOfIntersectionIt++);
     }
 }
 
-Value::Value(const Value& parent, const unsigned int intersectionIdParam, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd): dataId(parent.dataId), intersectionId(intersectionIdParam), presentNoise(parent.presentNoise), presentAndPotentialNoise(parent.presentAndPotentialNoise), intersectionsWithPresentValues(), intersectionsWithPresentAndPotentialValues()
+Value::Value(const Value& parent, const unsigned int intersectionIdParam, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena): dataId(parent.dataId), intersectionId(intersectionIdParam), presentNoise(parent.presentNoise), presentAndPotentialNoise(parent.presentAndPotentialNoise), intersectionsWithPresentValues(arena), intersectionsWithPresentAndPotentialValues(arena)
+{
+  allocateIntersections(sizeOfAttributeIt, sizeOfAttributeEnd, arena);
+}
+
+void Value::allocateIntersections(const vector<unsigned int>::const_iterator sizeOfAttributeBegin, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena)
 {
-  const unsigned int sizeOfIntersections = parent.intersectionsWithPresentValues.size();
-  intersectionsWithPresentValues.resize(sizeOfIntersections);
-  vector<vector<unsigned int>>::iterator intersectionsWithPresentValuesIt = intersectionsWithPresentValues.begin();
-  intersectionsWithPresentAndPotentialValues.resize(sizeOfIntersections);
-  vector<vector<unsigned int>>::iterator intersectionsWithPresentAndPotentialValuesIt = intersectionsWithPresentAndPotentialValues.begin();
-  for (vector<unsigned int>::const_iterator sizeIt = sizeOfAttributeIt; sizeIt != sizeOfAttributeEnd; ++sizeIt)
+  // Both matrices are in one buffer: the rows with the present values, then the rows with the present and potential values
+  const unsigned int nbOfIntersections = sizeOfAttributeEnd - sizeOfAttributeBegin;
+  intersectionsWithPresentValues.reserve(nbOfIntersections);
+  intersectionsWithPresentAndPotentialValues.reserve(nbOfIntersections);
+  const unsigned int sizeOfMatrix = accumulate(sizeOfAttributeBegin, sizeOfAttributeEnd, 0u);
+  unsigned int* row = static_cast<unsigned int*>(arena.allocate(2 * sizeOfMatrix * sizeof(unsigned int), alignof(unsigned int)));
+  for (vector<unsigned int>::const_iterator sizeOfAttributeIt = sizeOfAttributeBegin; sizeOfAttributeIt != sizeOfAttributeEnd; ++sizeOfAttributeIt)
     {
-      intersectionsWithPresentValuesIt->reserve(*sizeIt);
-      ++intersectionsWithPresentValuesIt;
-      intersectionsWithPresentAndPotentialValuesIt->reserve(*sizeIt);
-      ++intersectionsWithPresentAndPotentialValuesIt;
+      intersectionsWithPresentValues.push_back(row);
+      intersectionsWithPresentAndPotentialValues.push_back(row + sizeOfMatrix);
+      row += *sizeOfAttributeIt;
     }
 }
 
@@ -78,30 +87,30 @@ const unsigned int Value::getPresentAndPotentialNoise() const
 
 void Value::addPresentNoise(const unsigned int noise)
 {
-  presentNoise += noise;
+  Trail::increase(presentNoise, noise);
 }
 
 void Value::substractPotentialNoise(const unsigned int noise)
 {
-  presentAndPotentialNoise -= noise;
+  Trail::decrease(presentAndPotentialNoise, noise);
 }
 
-vector<vector<unsigned int>>::iterator Value::getIntersectionsBeginWithPresentValues()
+Intersections::iterator Value::getIntersectionsBeginWithPresentValues()
 {
   return intersectionsWithPresentValues.begin();
 }
 
-vector<vector<unsigned int>>::const_iterator Value::getIntersectionsBeginWithPresentValues() const
+Intersections::const_iterator Value::getIntersectionsBeginWithPresentValues() const
 {
   return intersectionsWithPresentValues.begin();
 }
 
-vector<vector<unsigned int>>::iterator Value::getIntersectionsBeginWithPresentAndPotentialValues()
+Intersections::iterator Value::getIntersectionsBeginWithPresentAndPotentialValues()
 {
   return intersectionsWithPresentAndPotentialValues.begin();
 }
 
-vector<vector<unsigned int>>::const_iterator Value::getIntersectionsBeginWithPresentAndPotentialValues() const
+Intersections::const_iterator Value::getIntersectionsBeginWithPresentAndPotentialValues() const
 {
   return intersectionsWithPresentAndPotentialValues.begin();
 }
@@ -117,12 +126,7 @@ const bool Value::extendsPastPresent(const vector<Value*>::const_iterator valueB
 
 const bool Value::extendsFuturePresent(const vector<Value*>::const_iterator valueBegin, const vector<Value*>::const_iterator valueEnd, const unsigned int threshold, const unsigned int reverseAttributeIndex) const
 {
-  const vector<unsigned int>& presentIntersectionsWithFutureValues = intersectionsWithPresentValues[intersectionsWithPresentValues.size() - reverseAttributeIndex];
-  vector<Value*>::const_iterator valueIt = valueBegin;
-  for (; valueIt != valueEnd && (*valueIt)->presentNoise + presentIntersectionsWithFutureValues[(*valueIt)->intersectionId] <= threshold; ++valueIt)
-    {
-    }
-  return valueIt == valueEnd;
+  return futureValuesWithinThreshold(valueBegin, valueEnd, &Value::presentNoise, intersectionsWithPresentValues[intersectionsWithPresentValues.size() - reverseAttributeIndex], nullptr, threshold);
 }
 
 const bool Value::extendsPastPresentAndPotential(const vector<Value*>::const_iterator valueBegin, const vector<Value*>::const_iterator valueEnd, const unsigned int threshold, const unsigned int intersectionIndex) const
@@ -136,12 +140,7 @@ const bool Value::extendsPastPresentAndPotential(const vector<Value*>::const_ite
 
 const bool Value::extendsFuturePresentAndPotential(const vector<Value*>::const_iterator valueBegin, const vector<Value*>::const_iterator valueEnd, const unsigned int threshold, const unsigned int reverseAttributeIndex) const
 {
-  const vector<unsigned int>& presentAndPotentialIntersectionsWithFutureValues = intersectionsWithPresentAndPotentialValues[intersectionsWithPresentAndPotentialValues.size() - reverseAttributeIndex];
-  vector<Value*>::const_iterator valueIt = valueBegin;
-  for (; valueIt != valueEnd && (*valueIt)->presentAndPotentialNoise + presentAndPotentialIntersectionsWithFutureValues[(*valueIt)->intersectionId] <= threshold; ++valueIt)
-    {
-    }
-  return valueIt == valueEnd;
+  return futureValuesWithinThreshold(valueBegin, valueEnd, &Value::presentAndPotentialNoise, intersectionsWithPresentAndPotentialValues[intersectionsWithPresentAndPotentialValues.size() - reverseAttributeIndex], nullptr, threshold);
 }
 
 const bool Value::symmetricValuesExtendPastPresent(const vector<Value*>::const_iterator valueBegin, const vector<Value*>::const_iterator valueEnd, const unsigned int threshold, const unsigned int intersectionIndex) const
@@ -156,13 +155,7 @@ const bool Value::symmetricValuesExtendPastPresent(const vector<Value*>::const_i
 const bool Value::symmetricValuesExtendFuturePresent(const Value& symmetricValue, const vector<Value*>::const_iterator valueBegin, const vector<Value*>::const_iterator valueEnd, const unsigned int threshold, const unsigned int reverseAttributeIndex) const
 {
   const unsigned int intersectionIndex = intersectionsWithPresentValues.size() - reverseAttributeIndex;
-  const vector<unsigned int>& presentIntersectionsWithFutureValues1 = intersectionsWithPresentValues[intersectionIndex + 1];
-  const vector<unsigned int>& presentIntersectionsWithFutureValues2 = symmetricValue.intersectionsWithPresentValues[intersectionIndex];
-  vector<Value*>::const_iterator valueIt = valueBegin;
-  for (; valueIt != valueEnd && (*valueIt)->presentNoise + presentIntersectionsWithFutureValues1[(*valueIt)->intersectionId] + presentIntersectionsWithFutureValues2[(*valueIt)->intersectionId] <= threshold; ++valueIt)
-    {
-    }
-  return valueIt == valueEnd;
+  return futureValuesWithinThreshold(valueBegin, valueEnd, &Value::presentNoise, intersectionsWithPresentValues[intersectionIndex + 1], symmetricValue.intersectionsWithPresentValues[intersectionIndex], threshold);
 }
 
 const bool Value::symmetricValuesExtendPastPresentAndPotential(const vector<Value*>::const_iterator valueBegin, const vector<Value*>::const_iterator valueEnd, const unsigned int threshold, const unsigned int intersectionIndex) const
@@ -177,15 +170,97 @@ const bool Value::symmetricValuesExtendPastPresentAndPotential(const vector<Valu
 const bool Value::symmetricValuesExtendFuturePresentAndPotential(const Value& symmetricValue, const vector<Value*>::const_iterator valueBegin, const vector<Value*>::const_iterator valueEnd, const unsigned int threshold, const unsigned int reverseAttributeIndex) const
 {
   const unsigned int intersectionIndex = intersectionsWithPresentAndPotentialValues.size() - reverseAttributeIndex;
-  const vector<unsigned int>& presentAndPotentialIntersectionsWithFutureValues1 = intersectionsWithPresentAndPotentialValues[intersectionIndex + 1];
-  const vector<unsigned int>& presentAndPotentialIntersectionsWithFutureValues2 = symmetricValue.intersectionsWithPresentAndPotentialValues[intersectionIndex];
-  vector<Value*>::const_iterator valueIt = valueBegin;
-  for (; valueIt != valueEnd && (*valueIt)->presentAndPotentialNoise + presentAndPotentialIntersectionsWithFutureValues1[(*valueIt)->intersectionId] + presentAndPotentialIntersectionsWithFutureValues2[(*valueIt)->intersectionId] <= threshold; ++valueIt)
+  return futureValuesWithinThreshold(valueBegin, valueEnd, &Value::presentAndPotentialNoise, intersectionsWithPresentAndPotentialValues[intersectionIndex + 1], symmetricValue.intersectionsWithPresentAndPotentialValues[intersectionIndex], threshold);
+}
+
+const bool Value::futureValuesWithinThresholdScalar(vector<Value*>::const_iterator valueIt, const vector<Value*>::const_iterator valueEnd, const unsigned int Value::* noise, const unsigned int* intersections, const unsigned int* otherIntersections, const unsigned int threshold)
+{
+  if (otherIntersections)
+    {
+      for (; valueIt != valueEnd && (*valueIt)->*noise + intersections[(*valueIt)->intersectionId] + otherIntersections[(*valueIt)->intersectionId] <= threshold; ++valueIt)
+	{
+	}
+      return valueIt == valueEnd;
+    }
+  for (; valueIt != valueEnd && (*valueIt)->*noise + intersections[(*valueIt)->intersectionId] <= threshold; ++valueIt)
     {
     }
   return valueIt == valueEnd;
 }
 
+#ifdef X86_SIMD
+__attribute__((target("avx2"))) const bool Value::futureValuesWithinThresholdAVX2(vector<Value*>::const_iterator valueIt, const vector<Value*>::const_iterator valueEnd, const unsigned int Value::* noise, const unsigned int* intersections, const unsigned int* otherIntersections, const unsigned int threshold)
+{
+  // Blocks of 8 values: their noises and intersection ids are collected, the noises in the intersections are gathered, summed and compared to the threshold at once
+  const __m256i thresholds = _mm256_set1_epi32(threshold);
+  alignas(32) unsigned int noises[8];
+  alignas(32) unsigned int intersectionIds[8];
+  for (; valueEnd - valueIt >= 8; valueIt += 8)
+    {
+      for (unsigned int lane = 0; lane != 8; ++lane)
+	{
+	  noises[lane] = valueIt[lane]->*noise;
+	  intersectionIds[lane] = valueIt[lane]->intersectionId;
+	}
+      const __m256i intersectionIdVector = _mm256_load_si256(reinterpret_cast<const __m256i*>(intersectionIds));
+      __m256i sums = _mm256_add_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(noises)), _mm256_i32gather_epi32(reinterpret_cast<const int*>(intersections), intersectionIdVector, 4));
+      if (otherIntersections)
+	{
+	  sums = _mm256_add_epi32(sums, _mm256_i32gather_epi32(reinterpret_cast<const int*>(otherIntersections), intersectionIdVector, 4));
+	}
+      // Every sum is at most the threshold iff it equals its minimum with the threshold
+      if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_min_epu32(sums, thresholds), sums)) != -1)
+	{
+	  return false;
+	}
+    }
+  return futureValuesWithinThresholdScalar(valueIt, valueEnd, noise, intersections, otherIntersections, threshold);
+}
+
+__attribute__((target("avx512f"))) const bool Value::futureValuesWithinThresholdAVX512(vector<Value*>::const_iterator valueIt, const vector<Value*>::const_iterator valueEnd, const unsigned int Value::* noise, const unsigned int* intersections, const unsigned int* otherIntersections, const unsigned int threshold)
+{
+  // Same as futureValuesWithinThresholdAVX2 with blocks of 16 values
+  const __m512i thresholds = _mm512_set1_epi32(threshold);
+  alignas(64) unsigned int noises[16];
+  alignas(64) unsigned int intersectionIds[16];
+  for (; valueEnd - valueIt >= 16; valueIt += 16)
+    {
+      for (unsigned int lane = 0; lane != 16; ++lane)
+	{
+	  noises[lane] = valueIt[lane]->*noise;
+	  intersectionIds[lane] = valueIt[lane]->intersectionId;
+	}
+      const __m512i intersectionIdVector = _mm512_load_si512(intersectionIds);
+      __m512i sums = _mm512_add_epi32(_mm512_load_si512(noises), _mm512_i32gather_epi32(intersectionIdVector, intersections, 4));
+      if (otherIntersections)
+	{
+	  sums = _mm512_add_epi32(sums, _mm512_i32gather_epi32(intersectionIdVector, otherIntersections, 4));
+	}
+      if (_mm512_cmpgt_epu32_mask(sums, thresholds))
+	{
+	  return false;
+	}
+    }
+  return futureValuesWithinThresholdAVX2(valueIt, valueEnd, noise, intersections, otherIntersections, threshold);
+}
+#endif
+
+Value::FutureValuesWithinThreshold Value::fastestFutureValuesWithinThreshold()
+{
+#ifdef X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    {
+      return futureValuesWithinThresholdAVX512;
+    }
+  if (__builtin_cpu_supports("avx2"))
+    {
+      return futureValuesWithinThresholdAVX2;
+    }
+#endif
+  return futureValuesWithinThresholdScalar;
+}
+
 /*debug*/
 // vector<vector<unsigned int>> Value::getIntersectionsWithPresentValues() const
 // {
@@ -11,18 +11,20 @@
 #ifndef VALUE_H_
 #define VALUE_H_
 
-#include "../../Parameters.h"
+#include "../utilities/Arena.h"
+#include "Trail.h"
 
-#include <vector>
+#if defined __GNUC__ && defined __x86_64__
+#define X86_SIMD
+#endif
 
-using namespace std;
+typedef vector<unsigned int*, ArenaAllocator<unsigned int*>> Intersections; /* rows of a flat buffer, one row per subsequent attribute */
 
 class Value
 {
  public:
-  Value(const unsigned int dataId);
-  Value(const unsigned int dataId, const unsigned int presentAndPotentialNoise, const vector<unsigned int>::const_iterator nbOfValuesPerAttributeBegin, const vector<unsigned int>::const_iterator nbOfValuesPerAttributeEnd, const vector<unsigned int>& noisesInIntersections);
-  Value(const Value& otherValue, const unsigned int intersectionId, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd);
+  Value(const unsigned int dataId, const unsigned int presentAndPotentialNoise, const vector<unsigned int>::const_iterator nbOfValuesPerAttributeBegin, const vector<unsigned int>::const_iterator nbOfValuesPerAttributeEnd, const vector<unsigned int>& noisesInIntersections, Arena& arena);
+  Value(const Value& otherValue, const unsigned int intersectionId, const vector<unsigned int>::const_iterator sizeOfAttributeIt, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena);
 
   const bool operator<(const Value& otherValue) const;
 
@@ -32,10 +34,10 @@ class Value
   const unsigned int getPresentAndPotentialNoise() const;
   void addPresentNoise(const unsigned int noise);
   void substractPotentialNoise(const unsigned int noise);
-  vector<vector<unsigned int>>::iterator getIntersectionsBeginWithPresentValues();
-  vector<vector<unsigned int>>::const_iterator getIntersectionsBeginWithPresentValues() const;
-  vector<vector<unsigned int>>::iterator getIntersectionsBeginWithPresentAndPotentialValues();
-  vector<vector<unsigned int>>::const_iterator getIntersectionsBeginWithPresentAndPotentialValues() const;
+  Intersections::iterator getIntersectionsBeginWithPresentValues();
+  Intersections::const_iterator getIntersectionsBeginWithPresentValues() const;
+  Intersections::iterator getIntersectionsBeginWithPresentAndPotentialValues();
+  Intersections::const_iterator getIntersectionsBeginWithPresentAndPotentialValues() const;
 
   const unsigned int getNoiseInPresentIntersectionWith(const unsigned int reverseIndex, const Value& otherValue) const;
 
@@ -61,8 +63,22 @@ class Value
   unsigned int intersectionId;
   unsigned int presentNoise;
   unsigned int presentAndPotentialNoise;
-  vector<vector<unsigned int>> intersectionsWithPresentValues;
-  vector<vector<unsigned int>> intersectionsWithPresentAndPotentialValues;
+  Intersections intersectionsWithPresentValues;
+  Intersections intersectionsWithPresentAndPotentialValues;
+
+  typedef const bool (*FutureValuesWithinThreshold)(vector<Value*>::const_iterator valueIt, const vector<Value*>::const_iterator valueEnd, const unsigned int Value::* noise, const unsigned int* intersections, const unsigned int* otherIntersections, const unsigned int threshold);
+
+  static const FutureValuesWithinThreshold futureValuesWithinThreshold; /* the fastest kernel the processor supports */
+
+  void allocateIntersections(const vector<unsigned int>::const_iterator sizeOfAttributeBegin, const vector<unsigned int>::const_iterator sizeOfAttributeEnd, Arena& arena);
+
+  // otherIntersections may be nullptr; otherwise its noises are added (symmetric attributes)
+  static const bool futureValuesWithinThresholdScalar(vector<Value*>::const_iterator valueIt, const vector<Value*>::const_iterator valueEnd, const unsigned int Value::* noise, const unsigned int* intersections, const unsigned int* otherIntersections, const unsigned int threshold);
+#ifdef X86_SIMD
+  static const bool futureValuesWithinThresholdAVX2(vector<Value*>::const_iterator valueIt, const vector<Value*>::const_iterator valueEnd, const unsigned int Value::* noise, const unsigned int* intersections, const unsigned int* otherIntersections, const unsigned int threshold);
+  static const bool futureValuesWithinThresholdAVX512(vector<Value*>::const_iterator valueIt, const vector<Value*>::const_iterator valueEnd, const unsigned int Value::* noise, const unsigned int* intersections, const unsigned int* otherIntersections, const unsigned int threshold);
+#endif
+  static FutureValuesWithinThreshold fastestFutureValuesWithinThreshold();
 };
 
 #endif /*VALUE_H_*/
@@ -60,6 +60,9 @@ template<typename T> vector<vector<T>> getMatrixFromFile(const string& fileName)
 int main(int argc, char* argv[])
 {
   double maximalNbOfCandidateAgglomerates = 0;
+  unsigned int nbOfThreads = 1;
+  unsigned int nbOfMembershipBits = 32;
+  unsigned int minNbOfPotentialElementsInTask = 32;
   Tree* root;
   // Parsing the command line and the option file
   try
@@ -114,10 +117,17 @@ int main(int argc, char* argv[])
 	("clique,c", value<string>(), "set attributes on which closed cliques are searched (0 being the first attribute)")
 	("tau,t", value<string>(), "set maximal differences between two contiguous elements in numerical attributes or 0 for infinity/non-numerical attribute (by default 0 for every attribute)")
 	("reduction,r", "do not compute closed ET-n-sets, only output the input data without the elements that cannot be in any closed ET-n-sets given the size constraints")
+	("convert", value<string>(), "do not compute closed ET-n-sets, only write the input data in binary format in the file in argument")
+	("save-reduced", value<string>(), "also write the data reduced by the pre-process in binary format in the file in argument")
+	("load-reduced", value<string>(), "read the reduced data in the file in argument, written with option --save-reduced, instead of the data file")
 	("ha", value<double>(&maximalNbOfCandidateAgglomerates), "hierarchically agglomerate the closed ET-n-sets (in argument, maximal nb of candidates in millions) and output the relevant agglomerates, more relevant first")
+	("ha-memory", value<double>(), "set maximal memory, in megabytes, of the candidate agglomerates, the least promising ones being evicted beyond (by default, unbounded)")
 	("shift", value<double>()->default_value(1), "set multiplier of the reduced dataset density as a similarity shift for agglomeration")
 	("unclosed,u", value<string>(), "set attributes in which the computed ET-n-sets need not be closed")
 	("density,d", value<float>()->default_value(1), "set threshold to trigger a dense storage of the data (0 for a completely dense storage, 1 for a sparse storage)")
+	("membership-bits", value<unsigned int>(&nbOfMembershipBits)->default_value(32), "set number of bits (8, 16 or 32) storing every membership degree in the dense storage of fuzzy data")
+	("threads", value<unsigned int>(&nbOfThreads)->default_value(1), "set number of threads parsing and pre-processing the data, computing closed ET-n-sets and constructing the candidate agglomerates (no effect on the computation if closed cliques or sky-patterns are searched)")
+	("task", value<unsigned int>(&minNbOfPotentialElementsInTask)->default_value(32), "set minimal number of potential elements for a subtree to be a task any thread can steal (by default 32)")
 	("large,l", "quick computation of closed ET-n-sets that are large in all the dimensions (longer extractions when other closed ET-n-sets are valid)")
 	("out,o", value<string>(&outputFileName), "set output file name (by default [data-file].out if closed ET-net sets are computed, [data-file].red if the input data is only reduced with option --reduction)")
 	("psky", "print pattern skyline whenever refined");
@@ -179,10 +189,11 @@ int main(int argc, char* argv[])
 	("css", value<string>()->default_value(" : "), "set string separating closed ET-n-sets from sizes in output data")
 	("ss", value<string>()->default_value(" "), "set string separating sizes of the different attributes in output data")
 	("pa", "print areas in output data")
-	("sas", value<string>()->default_value(" : "), "set string separating sizes from areas in output data");
+	("sas", value<string>()->default_value(" : "), "set string separating sizes from areas in output data")
+	("output-format", value<string>()->default_value("text"), "set output data format: \"text\" or \"binary\" (the separator options and --ps have no effect in binary, where areas are always written)");
       options_description hidden("Hidden options");
       hidden.add_options()
-	("data-file", value<string>(), "set input data file");
+	("data-file", value<string>(), "set input data file (\"-\" for the standard input)");
       positional_options_description p;
       p.add("data-file", -1);
       options_description commandLineOptions;
@@ -263,6 +274,51 @@ int main(int argc, char* argv[])
 	{
 	  throw UsageException("ha option should provide a strictly positive double!");
 	}
+      if (vm.count("ha-memory"))
+	{
+	  if (vm["ha-memory"].as<double>() <= 0)
+	    {
+	      throw UsageException("ha-memory option should provide a strictly positive double!");
+	    }
+	  Node::setMaximalCandidateMemory(vm["ha-memory"].as<double>() * 1000000);
+	}
+      if (nbOfThreads == 0)
+	{
+	  throw UsageException("threads option should provide a strictly positive integer!");
+	}
+      NoisyTupleFileReader::setNbOfThreads(nbOfThreads);
+      NoisyTuples::setNbOfThreads(nbOfThreads);
+      Node::setNbOfThreads(nbOfThreads);
+      if (vm.count("convert"))
+	{
+	  BinaryNoisyTupleFile::convert(vm["data-file"].as<string>().c_str(), vm["convert"].as<string>().c_str(), vm["ids"].as<string>().c_str(), vm["ies"].as<string>().c_str());
+	  return EX_OK;
+	}
+      if (vm.count("save-reduced") || vm.count("load-reduced"))
+	{
+	  if (vm.count("reduction"))
+	    {
+	      throw UsageException("save-reduced and load-reduced options are incompatible with reduction option!");
+	    }
+	  if (vm.count("save-reduced") && vm.count("load-reduced"))
+	    {
+	      throw UsageException("save-reduced and load-reduced options are mutually exclusive!");
+	    }
+	}
+      if (vm["output-format"].as<string>() != "text" && vm["output-format"].as<string>() != "binary")
+	{
+	  throw UsageException("output-format option should provide \"text\" or \"binary\"!");
+	}
+      const bool isOutputBinary = vm["output-format"].as<string>() == "binary";
+      if (isOutputBinary && vm.count("reduction"))
+	{
+	  throw UsageException("binary output format is incompatible with reduction option!");
+	}
+      if (nbOfMembershipBits != 8 && nbOfMembershipBits != 16 && nbOfMembershipBits != 32)
+	{
+	  throw UsageException("membership-bits option should provide 8, 16 or 32!");
+	}
+      Trie::setNbOfMembershipBits(nbOfMembershipBits);
       if (vm.count("area") && minArea < 0)
 	{
 	  throw UsageException("area option should provide a positive integer!");
@@ -395,11 +451,11 @@ int main(int argc, char* argv[])
 	{
 	  if (vm.count("reduction"))
 	    {
-	      outputFileName = vm["data-file"].as<string>() + ".red";
+	      outputFileName = (vm["data-file"].as<string>() == "-" ? "stdin" : vm["data-file"].as<string>()) + ".red";
 	    }
 	  else
 	    {
-	      outputFileName = vm["data-file"].as<string>() + ".out";
+	      outputFileName = (vm["data-file"].as<string>() == "-" ? "stdin" : vm["data-file"].as<string>()) + ".out";
 	    }
 	}
       if (vm.count("sky-s"))
@@ -509,9 +565,11 @@ int main(int argc, char* argv[])
 	      minSlope = -numeric_limits<float>::infinity();
 	    }
 	}
-      if (vm.count("sky-s") || vm.count("sky-S") || vm.count("sky-a") || vm.count("sky-A") || vm.count("sky-gs") || vm.count("sky-gS") || vm.count("sky-gr") || vm.count("sky-gps") || vm.count("sky-gl") || vm.count("sky-gf") || vm.count("sky-gyq") || vm.count("sky-gyy") || vm.count("sky-utility") || vm.count("sky-slope"))
+      const bool isSky = vm.count("sky-s") || vm.count("sky-S") || vm.count("sky-a") || vm.count("sky-A") || vm.count("sky-gs") || vm.count("sky-gS") || vm.count("sky-gr") || vm.count("sky-gps") || vm.count("sky-gl") || vm.count("sky-gf") || vm.count("sky-gyq") || vm.count("sky-gyy") || vm.count("sky-utility") || vm.count("sky-slope");
+      if (isSky)
 	{
-	  root = new SkyPatternTree(vm["data-file"].as<string>().c_str(), vm["density"].as<float>(), vm["shift"].as<double>(), epsilonVector, cliqueDimensions, tauVector, minSizes, minArea, vm.count("reduction"), maximalNbOfCandidateAgglomerates != 0, unclosedDimensions, vm["ies"].as<string>().c_str(), vm["ids"].as<string>().c_str(), outputFileName.c_str(), vm["ods"].as<string>().c_str(), vm["css"].as<string>().c_str(), vm["ss"].as<string>().c_str(), vm["sas"].as<string>().c_str(), vm.count("ps"), vm.count("pa"), vm.count("psky"));
+	  nbOfThreads = 1;
+	  root = new SkyPatternTree(vm["data-file"].as<string>().c_str(), vm["density"].as<float>(), vm["shift"].as<double>(), epsilonVector, cliqueDimensions, tauVector, minSizes, minArea, vm.count("reduction"), vm.count("save-reduced") ? vm["save-reduced"].as<string>().c_str() : "", vm.count("load-reduced") ? vm["load-reduced"].as<string>().c_str() : "", maximalNbOfCandidateAgglomerates != 0, unclosedDimensions, vm["ies"].as<string>().c_str(), vm["ids"].as<string>().c_str(), outputFileName.c_str(), vm["ods"].as<string>().c_str(), vm["css"].as<string>().c_str(), vm["ss"].as<string>().c_str(), vm["sas"].as<string>().c_str(), vm.count("ps"), vm.count("pa"), isOutputBinary, vm.count("psky"));
 	  try
 	    {
 	      static_cast<SkyPatternTree*>(root)->initMeasures(maxSizes, maxArea, maximizedSizeDimensions, minimizedSizeDimensions, vm.count("sky-a"), vm.count("sky-A"), groupFileNames, groupMinSizes, groupMaxSizes, groupMinRatios, groupMinPiatetskyShapiros, groupMinLeverages, groupMinForces, groupMinYulesQs, groupMinYulesYs, groupElementSeparator.c_str(), groupDimensionElementsSeparator.c_str(), groupMaximizedSizes, groupMinimizedSizes, groupMaximizedRatios, groupMaximizedPiatetskyShapiros, groupMaximizedLeverages, groupMaximizedForces, groupMaximizedYulesQs, groupMaximizedYulesYs, utilityValueFileName.c_str(), minUtility, valueElementSeparator.c_str(), valueDimensionSeparator.c_str(), vm.count("sky-utility"), slopePointFileName.c_str(), minSlope, pointElementSeparator.c_str(), pointDimensionSeparator.c_str(), vm.count("sky-slope"), vm["density"].as<float>());
@@ -524,7 +582,7 @@ int main(int argc, char* argv[])
 	}
       else
 	{
-	  root = new Tree(vm["data-file"].as<string>().c_str(), vm["density"].as<float>(), vm["shift"].as<double>(), epsilonVector, cliqueDimensions, tauVector, minSizes, minArea, vm.count("reduction"), maximalNbOfCandidateAgglomerates != 0, unclosedDimensions, vm["ies"].as<string>().c_str(), vm["ids"].as<string>().c_str(), outputFileName.c_str(), vm["ods"].as<string>().c_str(), vm["css"].as<string>().c_str(), vm["ss"].as<string>().c_str(), vm["sas"].as<string>().c_str(), vm.count("ps"), vm.count("pa"));
+	  root = new Tree(vm["data-file"].as<string>().c_str(), vm["density"].as<float>(), vm["shift"].as<double>(), epsilonVector, cliqueDimensions, tauVector, minSizes, minArea, vm.count("reduction"), vm.count("save-reduced") ? vm["save-reduced"].as<string>().c_str() : "", vm.count("load-reduced") ? vm["load-reduced"].as<string>().c_str() : "", maximalNbOfCandidateAgglomerates != 0, unclosedDimensions, vm["ies"].as<string>().c_str(), vm["ids"].as<string>().c_str(), outputFileName.c_str(), vm["ods"].as<string>().c_str(), vm["css"].as<string>().c_str(), vm["ss"].as<string>().c_str(), vm["sas"].as<string>().c_str(), vm.count("ps"), vm.count("pa"), isOutputBinary);
 	  try
 	    {
 	      root->initMeasures(maxSizes, maxArea, groupFileNames, groupMinSizes, groupMaxSizes, groupMinRatios, groupMinPiatetskyShapiros, groupMinLeverages, groupMinForces, groupMinYulesQs, groupMinYulesYs, groupElementSeparator.c_str(), groupDimensionElementsSeparator.c_str(), utilityValueFileName.c_str(), minUtility, valueElementSeparator.c_str(), valueDimensionSeparator.c_str(), slopePointFileName.c_str(), minSlope, pointElementSeparator.c_str(), pointDimensionSeparator.c_str(), vm["density"].as<float>());
@@ -535,7 +593,7 @@ int main(int argc, char* argv[])
 	      rethrow_exception(current_exception());
 	    }
 	}
-      Attribute::setDensityPrecedenceAndOutputFormat(vm.count("large"), vm["oes"].as<string>().c_str(), vm["empty"].as<string>().c_str(), vm["ens"].as<string>().c_str(), vm.count("pn"));
+      Attribute::setDensityPrecedenceAndOutputFormat(vm.count("large"), vm["oes"].as<string>().c_str(), vm["empty"].as<string>().c_str(), vm["ens"].as<string>().c_str(), vm.count("pn") && !isSky && !vm.count("ha"));
     }
   catch (unknown_option& e)
     {
@@ -557,7 +615,7 @@ int main(int argc, char* argv[])
       cerr << e.what() << endl;
       return EX_DATAERR;
     }
-  root->mine();
+  root->mine(nbOfThreads, minNbOfPotentialElementsInTask);
   root->terminate(maximalNbOfCandidateAgglomerates);
   delete root;
   return EX_OK;
@@ -10,8 +10,8 @@
 
 #include "GroupMeasure.h"
 
-vector<GroupMeasure*> GroupMeasure::firstMeasures;
-vector<GroupCovers*> GroupMeasure::groupCovers;
+thread_local vector<GroupMeasure*> GroupMeasure::firstMeasures;
+thread_local vector<GroupCovers*> GroupMeasure::groupCovers;
 bool GroupMeasure::isSomeMeasureMonotone = false;
 bool GroupMeasure::isSomeMeasureAntiMonotone = false;
 
@@ -92,6 +92,26 @@ unsigned int GroupMeasure::maxCoverOfGroup(const unsigned int groupId)
   return groupCovers.back()->maxCoverOfGroup(groupId);
 }
 
+void GroupMeasure::detachLastState(vector<GroupMeasure*>& detachedFirstMeasures, vector<GroupCovers*>& detachedGroupCovers)
+{
+  if (!firstMeasures.empty())
+    {
+      detachedFirstMeasures.push_back(firstMeasures.back());
+      firstMeasures.pop_back();
+      detachedGroupCovers.push_back(groupCovers.back());
+      groupCovers.pop_back();
+    }
+}
+
+void GroupMeasure::attachState(vector<GroupMeasure*>& detachedFirstMeasures, vector<GroupCovers*>& detachedGroupCovers)
+{
+  if (!detachedFirstMeasures.empty())
+    {
+      firstMeasures.push_back(detachedFirstMeasures.back());
+      groupCovers.push_back(detachedGroupCovers.back());
+    }
+}
+
 const bool GroupMeasure::violationAfterAdding(const unsigned int dimensionIdOfElementsSetPresent, const vector<unsigned int>& elementsSetPresent)
 {
   if (isSomeMeasureAntiMonotone)
@@ -29,13 +29,15 @@ class GroupMeasure: public Measure
   static void allMeasuresSet(); /* must be called after the construction of all group measures in (SkyPattern)Tree::initMeasures */
   static unsigned int minCoverOfGroup(const unsigned int groupId);
   static unsigned int maxCoverOfGroup(const unsigned int groupId);
+  static void detachLastState(vector<GroupMeasure*>& detachedFirstMeasures, vector<GroupCovers*>& detachedGroupCovers); /* to mine a subtree in another thread, the state of its measures leaves the stacks of the current thread... */
+  static void attachState(vector<GroupMeasure*>& detachedFirstMeasures, vector<GroupCovers*>& detachedGroupCovers); /* ... and enters those of the thread mining it */
 
   const bool violationAfterAdding(const unsigned int dimensionIdOfElementsSetPresent, const vector<unsigned int>& elementsSetPresent);
   const bool violationAfterRemoving(const unsigned int dimensionIdOfElementsSetAbsent, const vector<unsigned int>& elementsSetAbsent);
 
  protected:
-  static vector<GroupMeasure*> firstMeasures;
-  static vector<GroupCovers*> groupCovers;
+  static thread_local vector<GroupMeasure*> firstMeasures;
+  static thread_local vector<GroupCovers*> groupCovers;
   static bool isSomeMeasureMonotone;
   static bool isSomeMeasureAntiMonotone;
 
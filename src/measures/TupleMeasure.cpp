@@ -10,8 +10,8 @@
 
 #include "TupleMeasure.h"
 
-vector<TupleMeasure*> TupleMeasure::firstMeasures;
-vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>> TupleMeasure::presentAndPotential;
+thread_local vector<TupleMeasure*> TupleMeasure::firstMeasures;
+thread_local vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>> TupleMeasure::presentAndPotential;
 vector<bool> TupleMeasure::relevantDimensions;
 vector<bool> TupleMeasure::relevantDimensionsForMonotoneMeasures;
 
@@ -99,6 +99,26 @@ const vector<vector<unsigned int>>& TupleMeasure::potential()
   return presentAndPotential.back().second;
 }
 
+void TupleMeasure::detachLastState(vector<TupleMeasure*>& detachedFirstMeasures, vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>>& detachedPresentAndPotential)
+{
+  if (!firstMeasures.empty())
+    {
+      detachedFirstMeasures.push_back(firstMeasures.back());
+      firstMeasures.pop_back();
+      detachedPresentAndPotential.push_back(std::move(presentAndPotential.back()));
+      presentAndPotential.pop_back();
+    }
+}
+
+void TupleMeasure::attachState(vector<TupleMeasure*>& detachedFirstMeasures, vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>>& detachedPresentAndPotential)
+{
+  if (!detachedFirstMeasures.empty())
+    {
+      firstMeasures.push_back(detachedFirstMeasures.back());
+      presentAndPotential.push_back(std::move(detachedPresentAndPotential.back()));
+    }
+}
+
 const bool TupleMeasure::violationAfterAdding(const unsigned int dimensionIdOfElementsSetPresent, const vector<unsigned int>& elementsSetPresent)
 {
   if (relevantDimensions[dimensionIdOfElementsSetPresent])
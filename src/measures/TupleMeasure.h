@@ -29,13 +29,15 @@ class TupleMeasure: public Measure
   static void allMeasuresSet(const vector<unsigned int>& cardinalities); /* must be called after the construction of all tuple measures in (SkyPattern)Tree::initMeasures */
   static const vector<vector<unsigned int>>& present();
   static const vector<vector<unsigned int>>& potential();
-  
+  static void detachLastState(vector<TupleMeasure*>& detachedFirstMeasures, vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>>& detachedPresentAndPotential); /* to mine a subtree in another thread, the state of its measures leaves the stacks of the current thread... */
+  static void attachState(vector<TupleMeasure*>& detachedFirstMeasures, vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>>& detachedPresentAndPotential); /* ... and enters those of the thread mining it */
+
   const bool violationAfterAdding(const unsigned int dimensionIdOfElementsSetPresent, const vector<unsigned int>& elementsSetPresent);
   const bool violationAfterRemoving(const unsigned int dimensionIdOfElementsSetAbsent, const vector<unsigned int>& elementsSetAbsent);
 
  protected:
-  static vector<TupleMeasure*> firstMeasures;
-  static vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>> presentAndPotential;
+  static thread_local vector<TupleMeasure*> firstMeasures;
+  static thread_local vector<pair<vector<vector<unsigned int>>, vector<vector<unsigned int>>>> presentAndPotential;
   static vector<bool> relevantDimensions;
   static vector<bool> relevantDimensionsForMonotoneMeasures;
 
@@ -0,0 +1,50 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "Arena.h"
+
+const size_t Arena::chunkSize = 1 << 16;
+thread_local Arena::ChunkPool Arena::freeChunks;
+
+Arena::ChunkPool::~ChunkPool()
+{
+  for (char* chunk : chunks)
+    {
+      delete[] chunk;
+    }
+}
+
+Arena::Arena(): chunks(), largeBlocks(), next(nullptr), end(nullptr)
+{
+}
+
+Arena::~Arena()
+{
+  freeChunks.chunks.insert(freeChunks.chunks.end(), chunks.begin(), chunks.end());
+  for (char* largeBlock : largeBlocks)
+    {
+      delete[] largeBlock;
+    }
+}
+
+void Arena::newChunk()
+{
+  if (freeChunks.chunks.empty())
+    {
+      chunks.push_back(new char[chunkSize]);
+    }
+  else
+    {
+      chunks.push_back(freeChunks.chunks.back());
+      freeChunks.chunks.pop_back();
+    }
+  next = chunks.back();
+  end = next + chunkSize;
+}
@@ -0,0 +1,122 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+class Arena
+{
+ public:
+  Arena();
+  Arena(const Arena&) = delete;
+  Arena(Arena&&) = delete;
+
+  ~Arena(); /* everything allocated in the arena is released at once (without any destructor being called) */
+
+  Arena& operator=(const Arena&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  void* allocate(const size_t size, const size_t alignment);
+  template<typename T, typename... Args> T* create(Args&&... args);
+
+ protected:
+  struct ChunkPool
+  {
+    vector<char*> chunks;
+
+    ChunkPool(): chunks()
+    {
+    }
+
+    ~ChunkPool();
+  };
+
+  vector<char*> chunks;
+  vector<char*> largeBlocks;
+  char* next;
+  char* end;
+
+  static const size_t chunkSize;
+  static thread_local ChunkPool freeChunks; /* chunks of the destroyed arenas, reused by the next arenas of the same thread */
+
+  void newChunk();
+};
+
+template<typename T> class ArenaAllocator
+{
+ public:
+  typedef T value_type;
+
+  Arena* arena;
+
+  ArenaAllocator(Arena& arena);
+  template<typename U> ArenaAllocator(const ArenaAllocator<U>& otherAllocator);
+
+  T* allocate(const size_t n);
+  void deallocate(T* p, const size_t n);
+};
+
+template<typename T> ArenaAllocator<T>::ArenaAllocator(Arena& arenaParam): arena(&arenaParam)
+{
+}
+
+template<typename T> template<typename U> ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& otherAllocator): arena(otherAllocator.arena)
+{
+}
+
+template<typename T> inline T* ArenaAllocator<T>::allocate(const size_t n)
+{
+  return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+}
+
+template<typename T> inline void ArenaAllocator<T>::deallocate(T* p, const size_t n)
+{
+  // The memory is only released with the arena
+}
+
+template<typename T, typename U> inline const bool operator==(const ArenaAllocator<T>& allocator, const ArenaAllocator<U>& otherAllocator)
+{
+  return allocator.arena == otherAllocator.arena;
+}
+
+template<typename T, typename U> inline const bool operator!=(const ArenaAllocator<T>& allocator, const ArenaAllocator<U>& otherAllocator)
+{
+  return allocator.arena != otherAllocator.arena;
+}
+
+inline void* Arena::allocate(const size_t size, const size_t alignment)
+{
+  char* begin = reinterpret_cast<char*>((reinterpret_cast<size_t>(next) + alignment - 1) & ~(alignment - 1));
+  if (begin + size > end)
+    {
+      if (size > chunkSize / 4)
+	{
+	  largeBlocks.push_back(new char[size]);
+	  return largeBlocks.back();
+	}
+      newChunk();
+      begin = next;
+    }
+  next = begin + size;
+  return begin;
+}
+
+template<typename T, typename... Args> inline T* Arena::create(Args&&... args)
+{
+  return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+}
+
+#endif /*ARENA_H_*/
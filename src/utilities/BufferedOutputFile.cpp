@@ -0,0 +1,215 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "BufferedOutputFile.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+const unsigned int BufferedOutputFile::bufferSize = 1 << 20;
+const unsigned int BufferedOutputFile::maxNbOfFullBuffers = 16;
+unsigned int BufferedOutputFile::nbOfGenerations = 0;
+thread_local BufferedOutputFile::Buffer* BufferedOutputFile::threadBuffer = nullptr;
+thread_local unsigned int BufferedOutputFile::threadBufferGeneration = 0;
+
+BufferedOutputFile::Buffer::Buffer(BufferedOutputFile& fileParam): streambuf(), stream(this), file(fileParam), characters(bufferSize)
+{
+  setp(characters.data(), characters.data() + characters.size());
+}
+
+void BufferedOutputFile::Buffer::handOver()
+{
+  if (pptr() != pbase())
+    {
+      characters.resize(pptr() - pbase());
+      characters = file.exchange(std::move(characters));
+      characters.resize(bufferSize);
+      setp(characters.data(), characters.data() + characters.size());
+    }
+}
+
+BufferedOutputFile::Buffer::int_type BufferedOutputFile::Buffer::overflow(int_type character)
+{
+  // Grow rather than hand over a partial record
+  const unsigned long long size = pptr() - pbase();
+  characters.resize(2 * characters.size());
+  setp(characters.data(), characters.data() + characters.size());
+  pbump(size);
+  if (!traits_type::eq_int_type(character, traits_type::eof()))
+    {
+      *pptr() = traits_type::to_char_type(character);
+      pbump(1);
+    }
+  return traits_type::not_eof(character);
+}
+
+int BufferedOutputFile::Buffer::sync()
+{
+  if (static_cast<unsigned int>(pptr() - pbase()) >= bufferSize)
+    {
+      handOver();
+    }
+  return 0;
+}
+
+BufferedOutputFile::BufferedOutputFile(): fileDescriptor(-1), isCompressed(false), compressor(), compressedBuffer(), generation(0), nbOfHandedOverBytes(0), buffers(), fullBuffers(), emptyBuffers(), lock(), fullBufferAvailable(), fullBufferWritten(), isClosing(false), writer()
+{
+}
+
+BufferedOutputFile::~BufferedOutputFile()
+{
+  close();
+}
+
+void BufferedOutputFile::open(const char* fileName)
+{
+  fileDescriptor = ::open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fileDescriptor == -1)
+    {
+      throw NoFileException(fileName);
+    }
+  const size_t fileNameLength = strlen(fileName);
+  isCompressed = fileNameLength > 3 && strcmp(fileName + fileNameLength - 3, ".gz") == 0;
+  if (isCompressed)
+    {
+      // The fastest level: the output is compressed to be written faster
+      compressor = z_stream();
+      deflateInit2(&compressor, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+      compressedBuffer.resize(bufferSize);
+    }
+  generation = ++nbOfGenerations;
+  nbOfHandedOverBytes = 0;
+  isClosing = false;
+  writer = thread(&BufferedOutputFile::write, this);
+}
+
+ostream& BufferedOutputFile::stream()
+{
+  if (threadBufferGeneration != generation)
+    {
+      threadBuffer = new Buffer(*this);
+      threadBufferGeneration = generation;
+      unique_lock<mutex> guard(lock);
+      buffers.push_back(threadBuffer);
+    }
+  return threadBuffer->stream;
+}
+
+void BufferedOutputFile::close()
+{
+  if (fileDescriptor == -1)
+    {
+      return;
+    }
+  handOverAll();
+  for (Buffer* buffer : buffers)
+    {
+      delete buffer;
+    }
+  buffers.clear();
+  {
+    unique_lock<mutex> guard(lock);
+    isClosing = true;
+  }
+  fullBufferAvailable.notify_one();
+  writer.join();
+  ::close(fileDescriptor);
+  fileDescriptor = -1;
+  generation = 0;
+  emptyBuffers.clear();
+}
+
+const unsigned long long BufferedOutputFile::handOverAll()
+{
+  for (Buffer* buffer : buffers)
+    {
+      buffer->handOver();
+    }
+  return nbOfHandedOverBytes;
+}
+
+vector<char> BufferedOutputFile::exchange(vector<char>&& fullBuffer)
+{
+  unique_lock<mutex> guard(lock);
+  while (fullBuffers.size() == maxNbOfFullBuffers)
+    {
+      fullBufferWritten.wait(guard);
+    }
+  nbOfHandedOverBytes += fullBuffer.size();
+  fullBuffers.push_back(std::move(fullBuffer));
+  fullBufferAvailable.notify_one();
+  if (emptyBuffers.empty())
+    {
+      return vector<char>();
+    }
+  vector<char> emptyBuffer = std::move(emptyBuffers.back());
+  emptyBuffers.pop_back();
+  return emptyBuffer;
+}
+
+void BufferedOutputFile::write()
+{
+  unique_lock<mutex> guard(lock);
+  while (true)
+    {
+      while (fullBuffers.empty())
+	{
+	  if (isClosing)
+	    {
+	      if (isCompressed)
+		{
+		  compress(nullptr, nullptr, Z_FINISH);
+		  deflateEnd(&compressor);
+		  vector<char>().swap(compressedBuffer);
+		}
+	      return;
+	    }
+	  fullBufferAvailable.wait(guard);
+	}
+      vector<char> fullBuffer = std::move(fullBuffers.front());
+      fullBuffers.pop_front();
+      fullBufferWritten.notify_all();
+      guard.unlock();
+      if (isCompressed)
+	{
+	  compress(fullBuffer.data(), fullBuffer.data() + fullBuffer.size(), Z_NO_FLUSH);
+	}
+      else
+	{
+	  writeAll(fullBuffer.data(), fullBuffer.data() + fullBuffer.size());
+	}
+      fullBuffer.clear();
+      guard.lock();
+      emptyBuffers.push_back(std::move(fullBuffer));
+    }
+}
+
+void BufferedOutputFile::writeAll(const char* begin, const char* end) const
+{
+  for (ssize_t nbOfWrittenBytes; begin != end && (nbOfWrittenBytes = ::write(fileDescriptor, begin, end - begin)) > 0; )
+    {
+      begin += nbOfWrittenBytes;
+    }
+}
+
+void BufferedOutputFile::compress(const char* begin, const char* end, const int flush)
+{
+  compressor.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(begin));
+  compressor.avail_in = end - begin;
+  do
+    {
+      compressor.next_out = reinterpret_cast<Bytef*>(compressedBuffer.data());
+      compressor.avail_out = compressedBuffer.size();
+      deflate(&compressor, flush);
+      writeAll(compressedBuffer.data(), compressedBuffer.data() + compressedBuffer.size() - compressor.avail_out);
+    }
+  while (compressor.avail_out == 0);
+}
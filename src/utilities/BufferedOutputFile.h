@@ -0,0 +1,93 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef BUFFERED_OUTPUT_FILE_H_
+#define BUFFERED_OUTPUT_FILE_H_
+
+#include <vector>
+#include <deque>
+#include <ostream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <zlib.h>
+
+#include "NoFileException.h"
+
+using namespace std;
+
+/* Output file written by a background thread: every thread formats its output into its own large buffer, which is handed over to the background thread and written with a single system call once it is full and the stream is flushed (e.g., with endl), i.e., at the end of a record; if the file name ends with ".gz", the background thread also compresses the buffers in gzip format */
+class BufferedOutputFile
+{
+ public:
+  BufferedOutputFile();
+  BufferedOutputFile(const BufferedOutputFile&) = delete;
+  BufferedOutputFile(BufferedOutputFile&&) = delete;
+
+  ~BufferedOutputFile();
+
+  BufferedOutputFile& operator=(const BufferedOutputFile&) = delete;
+  BufferedOutputFile& operator=(BufferedOutputFile&&) = delete;
+
+  void open(const char* fileName);
+  ostream& stream(); /* the stream of the calling thread */
+  const unsigned long long handOverAll(); /* to be called when no other thread writes; returns the number of bytes handed over since the file was opened */
+  void close(); /* to be called when no other thread writes */
+
+ protected:
+  class Buffer final: public streambuf
+  {
+  public:
+    ostream stream;
+
+    Buffer(BufferedOutputFile& file);
+    Buffer(const Buffer&) = delete;
+    Buffer(Buffer&&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+    Buffer& operator=(Buffer&&) = delete;
+
+    void handOver();
+
+  protected:
+    BufferedOutputFile& file;
+    vector<char> characters;
+
+    int_type overflow(int_type character);
+    int sync();
+  };
+
+  int fileDescriptor;
+  bool isCompressed;
+  z_stream compressor;
+  vector<char> compressedBuffer;
+  unsigned int generation;
+  unsigned long long nbOfHandedOverBytes;
+  vector<Buffer*> buffers;
+  deque<vector<char>> fullBuffers;
+  vector<vector<char>> emptyBuffers;
+  mutex lock;
+  condition_variable fullBufferAvailable;
+  condition_variable fullBufferWritten;
+  bool isClosing;
+  thread writer;
+
+  static const unsigned int bufferSize;
+  static const unsigned int maxNbOfFullBuffers;
+  static unsigned int nbOfGenerations;
+  static thread_local Buffer* threadBuffer;
+  static thread_local unsigned int threadBufferGeneration;
+
+  void write();
+  void writeAll(const char* begin, const char* end) const;
+  void compress(const char* begin, const char* end, const int flush);
+  vector<char> exchange(vector<char>&& fullBuffer);
+};
+
+#endif /*BUFFERED_OUTPUT_FILE_H_*/
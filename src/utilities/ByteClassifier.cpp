@@ -0,0 +1,57 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "ByteClassifier.h"
+
+#if defined __GNUC__ && defined __x86_64__
+#define X86_SIMD
+#include <emmintrin.h>
+#endif
+
+ByteClassifier::ByteClassifier(const char* membersParam): members(membersParam), isMember()
+{
+  for (const char member : members)
+    {
+      isMember[static_cast<unsigned char>(member)] = true;
+    }
+}
+
+const char* ByteClassifier::findMember(const char* begin, const char* end) const
+{
+#ifdef X86_SIMD
+  // Blocks of 16 bytes (SSE2 is part of x86-64) are compared to every member at once
+  for (; end - begin >= 16; begin += 16)
+    {
+      const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+      __m128i matches = _mm_setzero_si128();
+      for (const char member : members)
+	{
+	  matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(member)));
+	}
+      const int matchMask = _mm_movemask_epi8(matches);
+      if (matchMask != 0)
+	{
+	  return begin + __builtin_ctz(matchMask);
+	}
+    }
+#endif
+  for (; begin != end && !contains(*begin); ++begin)
+    {
+    }
+  return begin;
+}
+
+const char* ByteClassifier::skipMembers(const char* begin, const char* end) const
+{
+  for (; begin != end && contains(*begin); ++begin)
+    {
+    }
+  return begin;
+}
@@ -0,0 +1,38 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef BYTE_CLASSIFIER_H_
+#define BYTE_CLASSIFIER_H_
+
+#include <string>
+
+using namespace std;
+
+/* Set of bytes (typically separators) in which to quickly search */
+class ByteClassifier
+{
+ public:
+  ByteClassifier(const char* members);
+
+  const bool contains(const char byte) const;
+  const char* findMember(const char* begin, const char* end) const; /* returns end if there is no member in [begin, end) */
+  const char* skipMembers(const char* begin, const char* end) const; /* returns end if there are only members in [begin, end) */
+
+ protected:
+  string members;
+  bool isMember[256];
+};
+
+inline const bool ByteClassifier::contains(const char byte) const
+{
+  return isMember[static_cast<unsigned char>(byte)];
+}
+
+#endif /*BYTE_CLASSIFIER_H_*/
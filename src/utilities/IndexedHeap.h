@@ -0,0 +1,133 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef INDEXED_HEAP_H_
+#define INDEXED_HEAP_H_
+
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+/* Array-based heap with arity children per node, whose elements store their positions in the heap (in their member position): an element can be erased or have its key changed in a time logarithmic in the size of the heap, without any allocation */
+template<typename T, unsigned int T::* position, unsigned int arity = 4>
+class IndexedHeap
+{
+ public:
+  IndexedHeap(const bool(*precedesParam)(const T*, const T*)): elements(), precedes(precedesParam)
+  {
+  }
+
+  const bool empty() const
+  {
+    return elements.empty();
+  }
+
+  T* top() const
+  {
+    return elements.front();
+  }
+
+  const vector<T*>& getElements() const
+  {
+    return elements;
+  }
+
+  void push(T* element)
+  {
+    element->*position = elements.size();
+    elements.push_back(element);
+    siftUp(element->*position);
+  }
+
+  void pop()
+  {
+    erase(elements.front());
+  }
+
+  void erase(T* element)
+  {
+    const unsigned int elementPosition = element->*position;
+    T* last = elements.back();
+    elements.pop_back();
+    if (last != element)
+      {
+	place(last, elementPosition);
+	update(last);
+      }
+  }
+
+  /* To be called after the key of element changed */
+  void update(T* element)
+  {
+    const unsigned int elementPosition = element->*position;
+    if (elementPosition != 0 && precedes(element, elements[(elementPosition - 1) / arity]))
+      {
+	siftUp(elementPosition);
+	return;
+      }
+    siftDown(elementPosition);
+  }
+
+ protected:
+  vector<T*> elements;
+  const bool(*precedes)(const T*, const T*);
+
+  void place(T* element, const unsigned int elementPosition)
+  {
+    elements[elementPosition] = element;
+    element->*position = elementPosition;
+  }
+
+  void siftUp(unsigned int elementPosition)
+  {
+    T* element = elements[elementPosition];
+    while (elementPosition != 0)
+      {
+	const unsigned int parentPosition = (elementPosition - 1) / arity;
+	if (!precedes(element, elements[parentPosition]))
+	  {
+	    break;
+	  }
+	place(elements[parentPosition], elementPosition);
+	elementPosition = parentPosition;
+      }
+    place(element, elementPosition);
+  }
+
+  void siftDown(unsigned int elementPosition)
+  {
+    T* element = elements[elementPosition];
+    const unsigned int size = elements.size();
+    for (unsigned int firstChildPosition = arity * elementPosition + 1; firstChildPosition < size; firstChildPosition = arity * elementPosition + 1)
+      {
+	// Find the child that precedes its siblings
+	unsigned int bestChildPosition = firstChildPosition;
+	const unsigned int childEnd = min(firstChildPosition + arity, size);
+	for (unsigned int childPosition = firstChildPosition + 1; childPosition < childEnd; ++childPosition)
+	  {
+	    if (precedes(elements[childPosition], elements[bestChildPosition]))
+	      {
+		bestChildPosition = childPosition;
+	      }
+	  }
+	if (!precedes(elements[bestChildPosition], element))
+	  {
+	    break;
+	  }
+	place(elements[bestChildPosition], elementPosition);
+	elementPosition = bestChildPosition;
+      }
+    place(element, elementPosition);
+  }
+};
+
+#endif /*INDEXED_HEAP_H_*/
@@ -0,0 +1,120 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "MappedFile.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+MappedFile::MappedFile(const char* fileName): mapping(nullptr), size(0), buffer()
+{
+  const int fileDescriptor = strcmp(fileName, "-") == 0 ? dup(STDIN_FILENO) : open(fileName, O_RDONLY);
+  if (fileDescriptor == -1)
+    {
+      throw NoFileException(fileName);
+    }
+  struct stat fileStatus;
+  if (fstat(fileDescriptor, &fileStatus) == 0 && S_ISREG(fileStatus.st_mode) && fileStatus.st_size != 0)
+    {
+      void* address = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+      if (address != MAP_FAILED)
+	{
+	  madvise(address, fileStatus.st_size, MADV_SEQUENTIAL);
+	  mapping = static_cast<const char*>(address);
+	  size = fileStatus.st_size;
+	  close(fileDescriptor);
+	  decompress(fileName);
+	  return;
+	}
+    }
+  // Not mappable (e.g., a pipe): read it all, directly into the buffer, whose size doubles whenever it is full
+  buffer.resize(1 << 20);
+  for (ssize_t nbOfReadBytes; (nbOfReadBytes = read(fileDescriptor, buffer.data() + size, buffer.size() - size)) > 0; )
+    {
+      size += nbOfReadBytes;
+      if (size == buffer.size())
+	{
+	  buffer.resize(2 * size);
+	}
+    }
+  close(fileDescriptor);
+  buffer.resize(size);
+  decompress(fileName);
+}
+
+MappedFile::~MappedFile()
+{
+  if (mapping)
+    {
+      munmap(const_cast<char*>(mapping), size);
+    }
+}
+
+void MappedFile::decompress(const char* fileName)
+{
+  if (size < 2 || begin()[0] != '\x1f' || begin()[1] != '\x8b')
+    {
+      return;
+    }
+  vector<char> decompressedBuffer(2 * size);
+  z_stream decompressor = z_stream();
+  inflateInit2(&decompressor, 15 + 16);
+  decompressor.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(begin()));
+  decompressor.avail_in = size;
+  size_t decompressedSize = 0;
+  for (int status = Z_OK; status != Z_STREAM_END || decompressor.avail_in != 0; )
+    {
+      if (status == Z_STREAM_END)
+	{
+	  // Concatenated gzip members
+	  inflateReset(&decompressor);
+	}
+      if (decompressedSize == decompressedBuffer.size())
+	{
+	  decompressedBuffer.resize(2 * decompressedBuffer.size());
+	}
+      decompressor.next_out = reinterpret_cast<Bytef*>(decompressedBuffer.data() + decompressedSize);
+      decompressor.avail_out = decompressedBuffer.size() - decompressedSize;
+      status = inflate(&decompressor, Z_NO_FLUSH);
+      decompressedSize = decompressedBuffer.size() - decompressor.avail_out;
+      if (status != Z_OK && status != Z_STREAM_END)
+	{
+	  inflateEnd(&decompressor);
+	  throw DataFormatException((string(fileName) + " is a corrupted gzip file!").c_str());
+	}
+    }
+  inflateEnd(&decompressor);
+  decompressedBuffer.resize(decompressedSize);
+  if (mapping)
+    {
+      munmap(const_cast<char*>(mapping), size);
+      mapping = nullptr;
+    }
+  buffer.swap(decompressedBuffer);
+  size = buffer.size();
+}
+
+const char* MappedFile::begin() const
+{
+  if (mapping)
+    {
+      return mapping;
+    }
+  return buffer.data();
+}
+
+const char* MappedFile::end() const
+{
+  return begin() + size;
+}
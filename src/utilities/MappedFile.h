@@ -0,0 +1,45 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef MAPPED_FILE_H_
+#define MAPPED_FILE_H_
+
+#include <vector>
+
+#include "NoFileException.h"
+#include "DataFormatException.h"
+
+using namespace std;
+
+/* Read-only view of a whole file, or of the standard input if the file name is "-": memory-mapped if it is a regular file, read into a buffer otherwise (e.g., a pipe, which is read once and never rewound); a file in gzip format is decompressed into the buffer */
+class MappedFile
+{
+ public:
+  MappedFile(const char* fileName);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+
+  ~MappedFile();
+
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+
+  const char* begin() const;
+  const char* end() const;
+
+ protected:
+  const char* mapping;
+  size_t size;
+  vector<char> buffer;
+
+  void decompress(const char* fileName);
+};
+
+#endif /*MAPPED_FILE_H_*/
@@ -0,0 +1,150 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include "WorkStealingPool.h"
+
+thread_local unsigned int WorkStealingPool::workerId = 0;
+thread_local const WorkStealingPool* WorkStealingPool::workerPool = nullptr;
+
+WorkStealingPool::WorkStealingPool(const unsigned int nbOfThreads): queues(), workers(), nbOfQueuedTasks(0), nbOfUnfinishedTasks(0), sleepLock(), wakeUp(), isStopping(false)
+{
+  queues.reserve(nbOfThreads);
+  for (unsigned int id = 0; id != nbOfThreads; ++id)
+    {
+      queues.push_back(new TaskQueue());
+    }
+  workers.reserve(nbOfThreads - 1);
+  for (unsigned int id = 1; id < nbOfThreads; ++id)
+    {
+      workers.push_back(thread(&WorkStealingPool::work, this, id));
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+  {
+    lock_guard<mutex> lock(sleepLock);
+    isStopping = true;
+  }
+  wakeUp.notify_all();
+  for (thread& worker : workers)
+    {
+      worker.join();
+    }
+  for (TaskQueue* queue : queues)
+    {
+      delete queue;
+    }
+}
+
+void WorkStealingPool::submit(std::function<void()>&& task)
+{
+  ++nbOfUnfinishedTasks;
+  TaskQueue& ownQueue = *queues[ownQueueId()];
+  {
+    lock_guard<mutex> lock(ownQueue.lock);
+    ownQueue.tasks.push_back(std::move(task));
+  }
+  {
+    lock_guard<mutex> lock(sleepLock);
+    ++nbOfQueuedTasks;
+  }
+  wakeUp.notify_one();
+}
+
+void WorkStealingPool::wait()
+{
+  while (nbOfUnfinishedTasks != 0)
+    {
+      if (!runOneTask())
+	{
+	  unique_lock<mutex> lock(sleepLock);
+	  wakeUp.wait(lock, [this] { return nbOfUnfinishedTasks == 0 || nbOfQueuedTasks != 0; });
+	}
+    }
+}
+
+void WorkStealingPool::work(const unsigned int id)
+{
+  workerId = id;
+  workerPool = this;
+  while (true)
+    {
+      if (!runOneTask())
+	{
+	  unique_lock<mutex> lock(sleepLock);
+	  wakeUp.wait(lock, [this] { return isStopping || nbOfQueuedTasks != 0; });
+	  if (isStopping)
+	    {
+	      return;
+	    }
+	}
+    }
+}
+
+const bool WorkStealingPool::runOneTask()
+{
+  std::function<void()> task;
+  if (!(popOwnTask(task) || stealTask(task)))
+    {
+      return false;
+    }
+  --nbOfQueuedTasks;
+  task();
+  if (--nbOfUnfinishedTasks == 0)
+    {
+      lock_guard<mutex> lock(sleepLock);
+      wakeUp.notify_all();
+    }
+  return true;
+}
+
+const bool WorkStealingPool::popOwnTask(std::function<void()>& task)
+{
+  // The most recent task is taken first: it is the deepest in the search and its data are hot in cache
+  TaskQueue& ownQueue = *queues[ownQueueId()];
+  lock_guard<mutex> lock(ownQueue.lock);
+  if (ownQueue.tasks.empty())
+    {
+      return false;
+    }
+  task = std::move(ownQueue.tasks.back());
+  ownQueue.tasks.pop_back();
+  return true;
+}
+
+const bool WorkStealingPool::stealTask(std::function<void()>& task)
+{
+  // The oldest task of another worker is stolen: it is the shallowest in the search, hence probably the largest
+  const unsigned int nbOfQueues = queues.size();
+  const unsigned int ownId = ownQueueId();
+  for (unsigned int offset = 1; offset < nbOfQueues; ++offset)
+    {
+      TaskQueue& victimQueue = *queues[(ownId + offset) % nbOfQueues];
+      lock_guard<mutex> lock(victimQueue.lock);
+      if (!victimQueue.tasks.empty())
+	{
+	  task = std::move(victimQueue.tasks.front());
+	  victimQueue.tasks.pop_front();
+	  return true;
+	}
+    }
+  return false;
+}
+
+const unsigned int WorkStealingPool::ownQueueId() const
+{
+  // A worker of another pool (e.g., a pool created in a task) uses the queue of the constructing thread
+  if (workerPool == this)
+    {
+      return workerId;
+    }
+  return 0;
+}
@@ -0,0 +1,69 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef WORK_STEALING_POOL_H_
+#define WORK_STEALING_POOL_H_
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+using namespace std;
+
+class WorkStealingPool
+{
+ public:
+  WorkStealingPool() = delete;
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool(WorkStealingPool&&) = delete;
+  WorkStealingPool(const unsigned int nbOfThreads); /* the constructing thread is worker 0, which only runs tasks in wait */
+
+  ~WorkStealingPool();
+
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(WorkStealingPool&&) = delete;
+
+  void submit(std::function<void()>&& task);
+  void wait();
+
+ protected:
+  struct TaskQueue
+  {
+    mutex lock;
+    deque<std::function<void()>> tasks;
+
+    TaskQueue(): lock(), tasks()
+    {
+    }
+  };
+
+  vector<TaskQueue*> queues;
+  vector<thread> workers;
+  atomic<unsigned int> nbOfQueuedTasks;
+  atomic<unsigned int> nbOfUnfinishedTasks;
+  mutex sleepLock;
+  condition_variable wakeUp;
+  bool isStopping;
+
+  static thread_local unsigned int workerId;
+  static thread_local const WorkStealingPool* workerPool; /* the pool workerId belongs to, nullptr for the threads that are not workers */
+
+  void work(const unsigned int id);
+  const unsigned int ownQueueId() const; /* workerId if the calling thread is a worker of this pool, 0 otherwise */
+  const bool runOneTask();
+  const bool popOwnTask(std::function<void()>& task);
+  const bool stealTask(std::function<void()>& task);
+};
+
+#endif /*WORK_STEALING_POOL_H_*/
@@ -0,0 +1,34 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef GALLOP_H_
+#define GALLOP_H_
+
+#include <algorithm>
+#include <iterator>
+
+/* Returns the first element in [first, last) that is not less than value, like std::lower_bound, but in a time logarithmic in the distance from first to that element: it suits the intersection of sorted sequences of very different sizes */
+template<typename RandomAccessIterator, typename T>
+RandomAccessIterator gallop(RandomAccessIterator first, const RandomAccessIterator last, const T& value)
+{
+  typename std::iterator_traits<RandomAccessIterator>::difference_type step = 1;
+  while (last - first > step && *(first + step) < value)
+    {
+      first += step;
+      step *= 2;
+    }
+  if (last - first > step)
+    {
+      return std::lower_bound(first, first + step + 1, value);
+    }
+  return std::lower_bound(first, last, value);
+}
+
+#endif /*GALLOP_H_*/
@@ -0,0 +1,25 @@
+// Copyright 2015 Loïc Cerf (lcerf@dcc.ufmg.br)
+
+// This file is part of multidupehack.
+
+// multidupehack is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License version 3 as published by the Free Software Foundation
+
+// multidupehack is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License along with multidupehack; if not, write to the Free Software Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef STRING_REF_HASH_H_
+#define STRING_REF_HASH_H_
+
+#include <boost/utility/string_ref.hpp>
+#include <boost/functional/hash.hpp>
+
+struct string_ref_hash
+{
+  size_t operator()(const boost::string_ref& s) const
+  {
+    return boost::hash_range(s.begin(), s.end());
+  }
+};
+
+#endif /*STRING_REF_HASH_H_*/